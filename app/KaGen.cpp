@@ -142,6 +142,25 @@ This is mostly useful for experimental graph generators or when using KaGen to l
 
     // Generator parameters
     app.add_option("-k,--num-chunks", config.k, "Number of chunks used for graph generation");
+    app.add_option("-t,--threads", config.num_threads)
+        ->description(
+            R"(Number of threads per PE. Threads generate the chunks of their PE concurrently, thus the number of chunks should be a multiple of the total number of threads.
+This is supported by communication-free generators (GNM, GNP, RGG and grid graphs); Kronecker graphs split the edges of each PE among its threads; METIS and edge list inputs split the byte range of each PE among its threads; other generators use a single thread.
+Sorting edges during finalization uses the same number of threads for all generators.)");
+    app.add_option("--exchange", config.exchange_strategy)
+        ->transform(CLI::CheckedTransformer(GetExchangeStrategyMap()).description(""))
+        ->description(R"(Communication pattern used to add reverse edges during postprocessing (RHG, BA). Possible strategies are:
+  - dense:  all-to-all exchange over all PEs (default)
+  - sparse: point-to-point messages to PEs that actually receive edges
+  - grid:   two-level exchange on a 2D processor grid, i.e., O(sqrt p) messages per PE)");
+    app.add_option("--memory-limit", config.memory_limit)
+        ->transform(CLI::AsSizeValue(false))
+        ->description(
+            R"(Maximum size of the edges buffered on each PE during generation, e.g., 4G (default: no limit).
+Edges exceeding the limit are written to sorted runs in the scratch directory, which are streamed into the edge exchange during finalization or merged back afterwards.
+Note that this sorts the local edges and removes duplicate edges. Not supported for generators with edge weights (image meshes).)");
+    app.add_option("--scratch-dir", config.scratch_directory, "Directory for edges that exceed the memory limit")
+        ->capture_default_str();
     app.add_option(
         "--automatic-num-chunks-imbalance-threshold", config.max_vertex_imbalance,
         "Controls the trade-off between vertex imbalance and number of chunks when deducing the number of chunks "
@@ -381,8 +400,14 @@ This is mostly useful for experimental graph generators or when using KaGen to l
         cmd->add_option("--input-format", config.static_graph.format)
             ->transform(CLI::CheckedTransformer(GetStaticGraphFormatMap()).description(""))
             ->description(R"(The following file formats are supported:
-  - metis:         Text format used by METIS
-  - binary-parhip: Binary format used by ParHIP)");
+  - metis:              Text format used by METIS
+  - binary-parhip:      Binary format used by ParHIP
+  - kagen:              KaGen's native binary CSR format
+  - manifest:           manifest of a distributed binary edge list output (<output>.manifest), can be loaded with any number of PEs
+  - edge-list:          SNAP style edge list with 0-based vertex IDs, or edge list written by KaGen ("e <u> <v>" with 1-based IDs)
+  - binary-edge-list:   pairs of 64 bit vertex IDs, optionally preceded by KaGen's header
+  - binary-edge-list32: pairs of 32 bit vertex IDs, optionally preceded by KaGen's header)");
+        cmd->add_flag("--symmetrize", config.static_graph.symmetrize, "Add reverse edges to edge list inputs");
     }
 
     // IO options
@@ -396,6 +421,7 @@ This is mostly useful for experimental graph generators or when using KaGen to l
   - metis:            format used by METIS
   - hmetis:           format used by hMETIS
   - binary-parhip:    binary format used by ParHIP
+  - kagen:            KaGen's native binary CSR format, can be loaded with the static generator
   - dot:              GraphViz format
   - coordinates:      text file containing x y z coordinates)");
     app.add_option("--output-header", config.output_header)
@@ -407,6 +433,18 @@ This is mostly useful for experimental graph generators or when using KaGen to l
   - always: every PE outputs a file header)");
     app.add_flag(
         "--distributed-output", [&config](auto) { config.output_single_file = false; }, "Output one file for each PE");
+    app.add_option("--compress", config.output_compression)
+        ->transform(CLI::CheckedTransformer(GetOutputCompressionMap()).description(""))
+        ->description(R"(Compress the output files, possible values are:
+  - none: write uncompressed files
+  - gzip: gzip-compressed files (.gz), requires zlib
+  - zstd: Zstandard-compressed files (.zst), requires libzstd
+Each PE compresses its part of the graph independently; not supported by the binary-parhip format.)");
+    app.add_flag("--stream", config.stream_output)
+        ->description(
+            R"(Write edges while they are generated instead of generating the whole graph first, such that only a small batch of edges is kept in memory.
+Requires a communication-free generator (GNM, GNP, RGG and grid graphs) and an edge list output format; otherwise, this option is ignored.
+Generation uses a single thread per PE. If the file header or the position of each PE's part in the file depend on the number of edges, the edges are generated twice.)");
 
     // coordinates output format implies --coordinates
     if (config.output_format == OutputFormat::COORDINATES) {
@@ -424,8 +462,7 @@ int main(int argc, char* argv[]) {
     CLI11_PARSE(app, argc, argv);
 
     // Run KaGen
-    auto graph = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
-    WriteGraph(config, graph, MPI_COMM_WORLD);
+    GenerateAndWriteGraph(config, MPI_COMM_WORLD);
 
     MPI_Finalize();
     return 0;
@@ -0,0 +1,89 @@
+// Measures the throughput of the text formatting routines of BufferedTextOutput, i.e., of the formats written by the
+// text output formats. The output is only counted, not written to disk.
+#include "kagen/io/buffered_writer.h"
+
+#include "../app/CLI11.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kagen;
+
+namespace {
+template <typename Format>
+void Benchmark(const std::string& name, const int repetitions, Format&& format) {
+    double      best_time = 0.0;
+    std::size_t num_bytes = 0;
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+        BufferedTextOutput<> out(tag::count);
+
+        const auto start = std::chrono::steady_clock::now();
+        format(out);
+        const auto   end  = std::chrono::steady_clock::now();
+        const double time = std::chrono::duration<double>(end - start).count();
+
+        if (rep == 0 || time < best_time) {
+            best_time = time;
+        }
+        num_bytes = out.GetNumberOfBytes();
+    }
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::setw(12) << num_bytes << " bytes"
+              << std::setw(12) << std::fixed << std::setprecision(1) << num_bytes / best_time / 1e6 << " MB/s"
+              << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::uint64_t num_values  = 1 << 24;
+    std::uint64_t max_id      = 1ull << 32;
+    int           repetitions = 5;
+
+    CLI::App app("Benchmark for the text formatting routines of KaGen's output formats");
+    app.add_option("-n,--values", num_values, "Number of values formatted per format")->capture_default_str();
+    app.add_option("--max-id", max_id, "Vertex IDs are drawn uniformly at random from [0, max-id)")
+        ->capture_default_str();
+    app.add_option("-r,--repetitions", repetitions, "Number of repetitions, the fastest one is reported")
+        ->capture_default_str();
+    CLI11_PARSE(app, argc, argv);
+
+    std::mt19937_64                              gen(42);
+    std::uniform_int_distribution<std::uint64_t> id_dist(0, max_id - 1);
+    std::uniform_real_distribution<double>       coord_dist(0.0, 1.0);
+
+    std::vector<std::uint64_t> ids(num_values);
+    std::vector<double>        coords(num_values);
+    for (std::uint64_t i = 0; i < num_values; ++i) {
+        ids[i]    = id_dist(gen);
+        coords[i] = coord_dist(gen);
+    }
+
+    // Like EdgeListWriter
+    Benchmark("edgelist", repetitions, [&](auto& out) {
+        for (std::uint64_t i = 0; i + 1 < num_values; i += 2) {
+            out.WriteString("e ").WriteInt(ids[i] + 1).WriteChar(' ').WriteInt(ids[i + 1] + 1).WriteChar('\n').Flush();
+        }
+    });
+
+    // Like MetisWriter: 16 neighbors per line
+    Benchmark("metis", repetitions, [&](auto& out) {
+        for (std::uint64_t i = 0; i < num_values; ++i) {
+            out.WriteInt(ids[i] + 1).WriteChar((i + 1) % 16 == 0 ? '\n' : ' ').Flush();
+        }
+    });
+
+    // Like CoordinatesWriter for 2D coordinates
+    Benchmark("coordinates", repetitions, [&](auto& out) {
+        for (std::uint64_t i = 0; i + 1 < num_values; i += 2) {
+            out.WriteFloat(coords[i]).WriteChar(' ').WriteFloat(coords[i + 1]).WriteChar('\n').Flush();
+        }
+    });
+
+    return 0;
+}
@@ -34,8 +34,8 @@ int main(int argc, char* argv[]) {
     size_t local_num_nodes;
     size_t local_num_edges;
 
-    kagen_index* xadj   = kagen_result_csr_xadj(graph, &local_num_nodes);
-    kagen_index* adjncy = kagen_result_csr_adjncy(graph, &local_num_edges);
+    kagen_index*  xadj   = kagen_result_csr_xadj(graph, &local_num_nodes);
+    kagen_vertex* adjncy = kagen_result_csr_adjncy(graph, &local_num_edges);
 
     printf("[PE%d] Xadj: ", rank);
     for (size_t i = 0; i < local_num_nodes + 1; i++) {
@@ -45,7 +45,7 @@ int main(int argc, char* argv[]) {
 
     printf("[PE%d] Adjncy: ", rank);
     for (size_t i = 0; i < local_num_edges; i++) {
-        printf("%lld ", adjncy[i]);
+        printf("%lld ", (long long)adjncy[i]);
     }
     printf("\n");
 
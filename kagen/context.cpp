@@ -18,6 +18,7 @@ std::unordered_map<std::string, OutputFormat> GetOutputFormatMap() {
         {"dot-directed", OutputFormat::DOT_DIRECTED},
         {"coordinates", OutputFormat::COORDINATES},
         {"binary-parhip", OutputFormat::BINARY_PARHIP},
+        {"kagen", OutputFormat::KAGEN},
     };
 }
 
@@ -52,6 +53,9 @@ std::ostream& operator<<(std::ostream& out, OutputFormat output_format) {
 
         case OutputFormat::BINARY_PARHIP:
             return out << "binary-parhip";
+
+        case OutputFormat::KAGEN:
+            return out << "kagen";
     }
 
     return out << "<invalid>";
@@ -80,6 +84,29 @@ std::ostream& operator<<(std::ostream& out, OutputHeader output_header) {
     return out << "<invalid>";
 }
 
+std::unordered_map<std::string, OutputCompression> GetOutputCompressionMap() {
+    return {
+        {"none", OutputCompression::NONE},
+        {"gzip", OutputCompression::GZIP},
+        {"zstd", OutputCompression::ZSTD},
+    };
+}
+
+std::ostream& operator<<(std::ostream& out, OutputCompression output_compression) {
+    switch (output_compression) {
+        case OutputCompression::NONE:
+            return out << "none";
+
+        case OutputCompression::GZIP:
+            return out << "gzip";
+
+        case OutputCompression::ZSTD:
+            return out << "zstd";
+    }
+
+    return out << "<invalid>";
+}
+
 std::unordered_map<std::string, GeneratorType> GetGeneratorTypeMap() {
     return {
         {"gnm-directed", GeneratorType::GNM_DIRECTED},
@@ -190,6 +217,29 @@ std::ostream& operator<<(std::ostream& out, StatisticsLevel statistics_level) {
     return out << "<invalid>";
 }
 
+std::unordered_map<std::string, ExchangeStrategy> GetExchangeStrategyMap() {
+    return {
+        {"dense", ExchangeStrategy::DENSE},
+        {"sparse", ExchangeStrategy::SPARSE},
+        {"grid", ExchangeStrategy::GRID},
+    };
+}
+
+std::ostream& operator<<(std::ostream& out, ExchangeStrategy exchange_strategy) {
+    switch (exchange_strategy) {
+        case ExchangeStrategy::DENSE:
+            return out << "dense";
+
+        case ExchangeStrategy::SPARSE:
+            return out << "sparse";
+
+        case ExchangeStrategy::GRID:
+            return out << "grid";
+    }
+
+    return out << "<invalid>";
+}
+
 std::unordered_map<std::string, ImageMeshWeightModel> GetImageMeshWeightModelMap() {
     return {
         {"l2", ImageMeshWeightModel::L2},          {"inv-l2", ImageMeshWeightModel::INV_L2},
@@ -237,6 +287,11 @@ std::unordered_map<std::string, StaticGraphFormat> GetStaticGraphFormatMap() {
     return {
         {"metis", StaticGraphFormat::METIS},
         {"binary-parhip", StaticGraphFormat::BINARY_PARHIP},
+        {"kagen", StaticGraphFormat::KAGEN},
+        {"manifest", StaticGraphFormat::MANIFEST},
+        {"edge-list", StaticGraphFormat::EDGE_LIST},
+        {"binary-edge-list", StaticGraphFormat::BINARY_EDGE_LIST},
+        {"binary-edge-list32", StaticGraphFormat::BINARY_EDGE_LIST32},
     };
 }
 
@@ -246,6 +301,16 @@ std::ostream& operator<<(std::ostream& out, const StaticGraphFormat format) {
             return out << "metis";
         case StaticGraphFormat::BINARY_PARHIP:
             return out << "binary-parhip";
+        case StaticGraphFormat::KAGEN:
+            return out << "kagen";
+        case StaticGraphFormat::MANIFEST:
+            return out << "manifest";
+        case StaticGraphFormat::EDGE_LIST:
+            return out << "edge-list";
+        case StaticGraphFormat::BINARY_EDGE_LIST:
+            return out << "binary-edge-list";
+        case StaticGraphFormat::BINARY_EDGE_LIST32:
+            return out << "binary-edge-list32";
     }
 
     return out << "<invalid>";
@@ -378,6 +443,7 @@ std::ostream& operator<<(std::ostream& out, const PGeneratorConfig& config) {
             out << "  Input file:                         " << config.static_graph.filename << "\n";
             out << "  File format:                        " << config.static_graph.format << "\n";
             out << "  Distribution:                       " << config.static_graph.distribution << "\n";
+            out << "  Add reverse edges:                  " << (config.static_graph.symmetrize ? "yes" : "no") << "\n";
             break;
     }
 
@@ -390,6 +456,16 @@ std::ostream& operator<<(std::ostream& out, const PGeneratorConfig& config) {
             out << "  Number of chunks:                   " << config.k << "\n";
         }
     }
+    if (config.num_threads > 1) {
+        out << "  Number of threads per PE:           " << config.num_threads << "\n";
+    }
+    if (config.exchange_strategy != ExchangeStrategy::DENSE) {
+        out << "  Exchange strategy:                  " << config.exchange_strategy << "\n";
+    }
+    if (config.memory_limit > 0) {
+        out << "  Memory limit per PE:                " << config.memory_limit << " bytes\n";
+        out << "  Scratch directory:                  " << config.scratch_directory << "\n";
+    }
     out << "-------------------------------------------------------------------------------\n";
 
     if (config.output_format != OutputFormat::NONE) {
@@ -397,7 +473,9 @@ std::ostream& operator<<(std::ostream& out, const PGeneratorConfig& config) {
         out << "  Filename:                           " << config.output_file << "\n";
         out << "  Output format:                      " << config.output_format << "\n";
         out << "  Output header:                      " << config.output_header << "\n";
+        out << "  Output compression:                 " << config.output_compression << "\n";
         out << "  Distributed output:                 " << (config.output_single_file ? "no" : "yes") << "\n";
+        out << "  Stream output:                      " << (config.stream_output ? "yes" : "no") << "\n";
         out << "-------------------------------------------------------------------------------\n";
     }
 
@@ -490,6 +568,7 @@ PGeneratorConfig CreateConfigFromString(const std::string& options_str, PGenerat
     config.n           = get_sint_or_default("n", 1ull << get_sint_or_default("N"));
     config.m           = get_sint_or_default("m", 1ull << get_sint_or_default("M"));
     config.k           = get_sint_or_default("k");
+    config.num_threads = get_sint_or_default("threads", config.num_threads);
     config.p           = get_hpfloat_or_default("prob");
     config.r           = get_hpfloat_or_default("radius");
     config.plexp       = get_hpfloat_or_default("gamma");
@@ -504,6 +583,18 @@ PGeneratorConfig CreateConfigFromString(const std::string& options_str, PGenerat
     config.rmat_c      = get_sint_or_default("rmat_c");
     config.coordinates = get_bool_or_default("coordinates");
 
+    config.memory_limit      = get_sint_or_default("memory_limit", config.memory_limit);
+    config.scratch_directory = get_string_or_default("scratch_directory", config.scratch_directory);
+
+    if (const std::string exchange_name = get_string_or_default("exchange"); !exchange_name.empty()) {
+        const auto exchange_strategies = GetExchangeStrategyMap();
+        const auto exchange_it         = exchange_strategies.find(exchange_name);
+        if (exchange_it == exchange_strategies.end()) {
+            throw std::runtime_error("invalid exchange strategy");
+        }
+        config.exchange_strategy = exchange_it->second;
+    }
+
     if (config.generator == GeneratorType::IMAGE_MESH) {
         const std::string filename = get_string_or_default("filename");
         if (filename.empty()) {
@@ -553,6 +644,8 @@ PGeneratorConfig CreateConfigFromString(const std::string& options_str, PGenerat
             throw std::runtime_error("invalid graph input format");
         }
         config.static_graph.format = format_it->second;
+
+        config.static_graph.symmetrize = get_bool_or_default("symmetrize");
     }
 
     return config;
@@ -27,6 +27,7 @@ enum class OutputFormat {
     DOT_DIRECTED,
     COORDINATES,
     BINARY_PARHIP,
+    KAGEN,
 };
 
 std::unordered_map<std::string, OutputFormat> GetOutputFormatMap();
@@ -43,6 +44,16 @@ std::unordered_map<std::string, OutputHeader> GetOutputHeaderMap();
 
 std::ostream& operator<<(std::ostream& out, OutputHeader output_header);
 
+enum class OutputCompression {
+    NONE,
+    GZIP,
+    ZSTD,
+};
+
+std::unordered_map<std::string, OutputCompression> GetOutputCompressionMap();
+
+std::ostream& operator<<(std::ostream& out, OutputCompression output_compression);
+
 enum class GeneratorType {
     GNM_DIRECTED,
     GNM_UNDIRECTED,
@@ -80,6 +91,16 @@ std::unordered_map<std::string, StatisticsLevel> GetStatisticsLevelMap();
 
 std::ostream& operator<<(std::ostream& out, StatisticsLevel statistics_level);
 
+enum class ExchangeStrategy : std::uint8_t {
+    DENSE  = 0, // MPI_Alltoall + MPI_Alltoallv
+    SPARSE = 1, // Point-to-point messages with NBX termination
+    GRID   = 2, // Two-level exchange on a 2D processor grid
+};
+
+std::unordered_map<std::string, ExchangeStrategy> GetExchangeStrategyMap();
+
+std::ostream& operator<<(std::ostream& out, ExchangeStrategy exchange_strategy);
+
 enum class ImageMeshWeightModel : std::uint8_t {
     L2         = 0,
     INV_L2     = 1,
@@ -120,6 +141,11 @@ std::ostream& operator<<(std::ostream& out, StaticGraphDistribution distribution
 enum class StaticGraphFormat {
     METIS,
     BINARY_PARHIP,
+    KAGEN,
+    MANIFEST,
+    EDGE_LIST,
+    BINARY_EDGE_LIST,
+    BINARY_EDGE_LIST32,
 };
 
 std::unordered_map<std::string, StaticGraphFormat> GetStaticGraphFormatMap();
@@ -130,6 +156,7 @@ struct StaticGraphConfig {
     std::string             filename     = "";
     StaticGraphFormat       format       = StaticGraphFormat::METIS;
     StaticGraphDistribution distribution = StaticGraphDistribution::BALANCE_VERTICES;
+    bool                    symmetrize   = false; // Add reverse edges to edge list inputs
 };
 
 // Configuration for the generator.
@@ -140,6 +167,9 @@ struct PGeneratorConfig {
     StatisticsLevel statistics_level      = StatisticsLevel::BASIC;
     bool            skip_postprocessing   = false;
     bool            print_header          = true;
+    int             num_threads           = 1;      // Threads per PE (comm.-free generators, Kronecker, file input)
+    SInt            memory_limit          = 0;      // Bytes of buffered edges per PE before spilling (0 = no limit)
+    std::string     scratch_directory     = "/tmp"; // Directory for spilled edges
 
     // Generator settings
     GeneratorType generator;          // Generator type
@@ -182,11 +212,16 @@ struct PGeneratorConfig {
     ULONG base_size   = 1 << 8; // Sampler base size
     ULONG hyp_base    = 1 << 8;
 
+    // Postprocessing settings
+    ExchangeStrategy exchange_strategy = ExchangeStrategy::DENSE; // Edge exchange used to add reverse edges
+
     // IO settings
-    OutputFormat output_format      = OutputFormat::EDGE_LIST; // Output format
-    OutputHeader output_header      = OutputHeader::ROOT;      // PEs that print file headers
-    std::string  output_file        = "out";                   // Output filename
-    bool         output_single_file = true;                    // Collect all graphs in a single output file
+    OutputFormat      output_format      = OutputFormat::EDGE_LIST; // Output format
+    OutputHeader      output_header      = OutputHeader::ROOT;      // PEs that print file headers
+    OutputCompression output_compression = OutputCompression::NONE; // Compression of the output files
+    std::string       output_file        = "out";                   // Output filename
+    bool              output_single_file = true;                    // Collect all graphs in a single output file
+    bool              stream_output      = false;                   // Write edges while generating them, if possible
 };
 
 std::ostream& operator<<(std::ostream& out, const PGeneratorConfig& config);
@@ -10,6 +10,8 @@
 #include <tuple>
 #include <vector>
 
+#include "kagen_config.h"
+
 namespace kagen {
 // Constants
 using LONG  = long long;
@@ -37,7 +39,17 @@ constexpr PEID ROOT = 0;
 
 enum Direction { Up, Down, Left, Right, Front, Back };
 
-using EdgeList    = std::vector<std::tuple<SInt, SInt>>;
+// Vertex IDs stored in edge lists and adjacency arrays: 32 bit IDs halve the memory required to store the graph, but
+// limit its size to less than 2^32 vertices (CMake option KAGEN_64BIT_VERTEX_IDS)
+#ifdef KAGEN_32BIT_VERTEX_IDS
+using VertexID = UINT;
+    #define KAGEN_MPI_VERTEXID KAGEN_MPI_UINT
+#else  // KAGEN_32BIT_VERTEX_IDS
+using VertexID = SInt;
+    #define KAGEN_MPI_VERTEXID KAGEN_MPI_SINT
+#endif // KAGEN_32BIT_VERTEX_IDS
+
+using EdgeList    = std::vector<std::tuple<VertexID, VertexID>>;
 using VertexRange = std::pair<SInt, SInt>;
 
 using Coordinates2D = std::vector<std::tuple<HPFloat, HPFloat>>;
@@ -48,7 +60,7 @@ using VertexWeights = std::vector<SSInt>;
 using EdgeWeights   = std::vector<SSInt>;
 
 using XadjArray   = std::vector<SInt>;
-using AdjncyArray = std::vector<SInt>;
+using AdjncyArray = std::vector<VertexID>;
 
 constexpr std::size_t NEWTON_MAX_ITERS = 10000;
 constexpr double      NEWTON_EPS       = 0.001;
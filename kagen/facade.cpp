@@ -1,13 +1,20 @@
 #include "kagen/facade.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
 #include <mpi.h>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 #include "kagen/context.h"
 #include "kagen/generators/generator.h"
+#include "kagen/generators/threaded_generator.h"
 #include "kagen/tools/statistics.h"
 
 // Generators
@@ -89,6 +96,29 @@ std::unique_ptr<GeneratorFactory> CreateGeneratorFactory(const GeneratorType typ
     __builtin_unreachable();
 }
 
+bool HasGlobalVertexIDOverflow(const Generator& generator, MPI_Comm comm) {
+    if constexpr (sizeof(VertexID) == sizeof(SInt)) {
+        return false;
+    }
+
+    bool overflow = generator.HasVertexIDOverflow();
+    MPI_Allreduce(MPI_IN_PLACE, &overflow, 1, MPI_CXX_BOOL, MPI_LOR, comm);
+    return overflow;
+}
+
+void CheckVertexIDWidth(const Generator& generator, MPI_Comm comm) {
+    if (HasGlobalVertexIDOverflow(generator, comm)) {
+        PEID rank;
+        MPI_Comm_rank(comm, &rank);
+        if (rank == ROOT) {
+            std::cerr << "Error: the graph has too many vertices for " << 8 * sizeof(VertexID)
+                      << " bit vertex IDs; rebuild KaGen with -DKAGEN_64BIT_VERTEX_IDS=On\n";
+        }
+        MPI_Barrier(comm);
+        MPI_Abort(comm, 1);
+    }
+}
+
 namespace {
 void PrintHeader(const PGeneratorConfig& config) {
     std::cout << "###############################################################################\n";
@@ -102,6 +132,42 @@ void PrintHeader(const PGeneratorConfig& config) {
     std::cout << "###############################################################################\n";
     std::cout << config;
 }
+
+PGeneratorConfig NormalizeParameters(
+    const GeneratorFactory& factory, const PGeneratorConfig& config_template, const PEID rank, const PEID size,
+    const bool output_info, MPI_Comm comm) {
+    try {
+        return factory.NormalizeParameters(config_template, rank, size, output_info);
+    } catch (ConfigurationError& ex) {
+        if (rank == ROOT) {
+            std::cerr << "Error: " << ex.what() << "\n";
+        }
+        MPI_Barrier(comm);
+        MPI_Abort(comm, 1);
+    }
+    __builtin_unreachable();
+}
+
+// Limits the number of OpenMP threads used outside of the generators, e.g., for sorting edges, to the number of threads
+// per PE requested by the user; restores the previous limit when leaving the scope
+class ScopedNumberOfThreads {
+public:
+    explicit ScopedNumberOfThreads([[maybe_unused]] const int num_threads) {
+#ifdef _OPENMP
+        previous_num_threads_ = omp_get_max_threads();
+        omp_set_num_threads(std::max(num_threads, 1));
+#endif
+    }
+
+    ~ScopedNumberOfThreads() {
+#ifdef _OPENMP
+        omp_set_num_threads(previous_num_threads_);
+#endif
+    }
+
+private:
+    [[maybe_unused]] int previous_num_threads_ = 1;
+};
 } // namespace
 
 Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation representation, MPI_Comm comm) {
@@ -112,20 +178,20 @@ Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation repr
     const bool output_error = rank == ROOT;
     const bool output_info  = rank == ROOT && !config_template.quiet;
 
+    ScopedNumberOfThreads scoped_num_threads(config_template.num_threads);
+
     if (output_info && config_template.print_header) {
         PrintHeader(config_template);
     }
 
-    auto             factory = CreateGeneratorFactory(config_template.generator);
-    PGeneratorConfig config;
-    try {
-        config = factory->NormalizeParameters(config_template, rank, size, output_info);
-    } catch (ConfigurationError& ex) {
-        if (output_error) {
-            std::cerr << "Error: " << ex.what() << "\n";
-        }
-        MPI_Barrier(comm);
-        MPI_Abort(comm, 1);
+    // Communication-free generators can use threads as virtual PEs
+    auto                   factory     = CreateGeneratorFactory(config_template.generator);
+    const int              num_threads = ComputeNumberOfThreads(*factory, config_template, size);
+    const PGeneratorConfig config =
+        NormalizeParameters(*factory, config_template, rank * num_threads, size * num_threads, output_info, comm);
+
+    if (output_info && config_template.num_threads > 1) {
+        std::cout << "Using " << num_threads << " thread(s) per PE" << std::endl;
     }
 
     // Generate graph
@@ -135,10 +201,15 @@ Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation repr
 
     const auto start_graphgen = MPI_Wtime();
 
-    auto generator = factory->Create(config, rank, size);
+    auto generator = (num_threads > 1) ? std::make_unique<ThreadedGenerator>(*factory, config, rank, size, num_threads)
+                                       : factory->Create(config, rank, size);
+    generator->SetMemoryLimit(config.memory_limit, config.scratch_directory, comm);
     generator->Generate(representation);
     MPI_Barrier(comm);
 
+    // Not collective with 64 bit vertex IDs, thus does not replace the barrier that ends the generation on all PEs
+    CheckVertexIDWidth(*generator, comm);
+
     if (output_info) {
         std::cout << "OK" << std::endl;
     }
@@ -150,6 +221,9 @@ Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation repr
     if (!config.skip_postprocessing) {
         generator->Finalize(comm);
         MPI_Barrier(comm);
+
+        // Some generators only determine their vertex ranges during finalization
+        CheckVertexIDWidth(*generator, comm);
     }
     if (output_info) {
         std::cout << "OK" << std::endl;
@@ -209,7 +283,7 @@ Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation repr
                 PrintBasicStatistics(graph.edges, graph.vertex_range, rank == ROOT, comm);
             }
             if (config.statistics_level >= StatisticsLevel::ADVANCED) {
-                PrintAdvancedStatistics(graph.edges, graph.vertex_range, rank == ROOT, comm);
+                PrintAdvancedStatistics(graph.edges, graph.edge_weights, graph.vertex_range, rank == ROOT, comm);
             }
         } else { // CSR
             if (config.statistics_level >= StatisticsLevel::BASIC) {
@@ -227,4 +301,70 @@ Graph Generate(const PGeneratorConfig& config_template, GraphRepresentation repr
 
     return graph;
 }
+
+std::unique_ptr<Generator> CreateStreamingGenerator(PGeneratorConfig& config, MPI_Comm comm) {
+    PEID rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    const bool output_error = rank == ROOT;
+    const bool output_info  = rank == ROOT && !config.quiet;
+
+    if (output_info && config.print_header) {
+        PrintHeader(config);
+    }
+
+    auto factory = CreateGeneratorFactory(config.generator);
+    config       = NormalizeParameters(*factory, config, rank, size, output_info, comm);
+
+    if (!factory->IsCommunicationFree()) {
+        if (output_error) {
+            std::cerr << "Error: the selected generator cannot stream its edges since it requires postprocessing\n";
+        }
+        MPI_Barrier(comm);
+        MPI_Abort(comm, 1);
+    }
+
+    return factory->Create(config, rank, size);
+}
+
+VertexRange StreamGraph(const PGeneratorConfig& config_template, EdgeSink& sink, const SInt buffer_size, MPI_Comm comm) {
+    PEID rank;
+    MPI_Comm_rank(comm, &rank);
+
+    PGeneratorConfig config    = config_template;
+    auto             generator = CreateStreamingGenerator(config, comm);
+
+    const bool output_info = rank == ROOT && !config.quiet;
+
+    if (output_info) {
+        std::cout << "Streaming graph ... " << std::flush;
+    }
+
+    const auto start_graphgen = MPI_Wtime();
+
+    generator->SetEdgeSink(&sink, buffer_size);
+    generator->Generate(GraphRepresentation::EDGE_LIST);
+    MPI_Barrier(comm);
+    CheckVertexIDWidth(*generator, comm);
+
+    const auto end_graphgen = MPI_Wtime();
+
+    if (output_info) {
+        std::cout << "OK" << std::endl;
+    }
+
+    if (!config.quiet) {
+        const SInt num_local_edges = generator->GetNumberOfEdges();
+        SInt       num_global_edges;
+        MPI_Reduce(&num_local_edges, &num_global_edges, 1, KAGEN_MPI_SINT, MPI_SUM, ROOT, comm);
+
+        if (output_info) {
+            std::cout << "Streamed " << num_global_edges << " edges in " << std::fixed << std::setprecision(3)
+                      << end_graphgen - start_graphgen << " seconds" << std::endl;
+        }
+    }
+
+    return generator->Take().vertex_range;
+}
 } // namespace kagen
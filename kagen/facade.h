@@ -12,4 +12,21 @@ namespace kagen {
 std::unique_ptr<GeneratorFactory> CreateGeneratorFactory(GeneratorType type);
 
 Graph Generate(const PGeneratorConfig& config, GraphRepresentation representation, MPI_Comm comm);
+
+// Vertex IDs might only be 32 bit wide, depending on the build configuration. Returns on all PEs whether any PE
+// generated a vertex ID that does not fit into VertexID; checks the IDs that were actually generated, since the number
+// of vertices is not known for all generators in advance. Collective unless vertex IDs are 64 bit wide.
+bool HasGlobalVertexIDOverflow(const Generator& generator, MPI_Comm comm);
+
+// Aborts with an error message if HasGlobalVertexIDOverflow().
+void CheckVertexIDWidth(const Generator& generator, MPI_Comm comm);
+
+// Creates the generator of a communication-free generator after normalizing `config` in place, which must outlive the
+// generator; aborts if the selected generator is not communication-free. Generating edges with the returned generator
+// does not communicate, thus PEs can stream their edges independently of each other, see Generator::SetEdgeSink().
+std::unique_ptr<Generator> CreateStreamingGenerator(PGeneratorConfig& config, MPI_Comm comm);
+
+// Generates the graph without materializing its edge list: local edges are passed to `sink` in batches of at most
+// `buffer_size` edges. Only available for communication-free generators. Returns the local vertex range.
+VertexRange StreamGraph(const PGeneratorConfig& config, EdgeSink& sink, SInt buffer_size, MPI_Comm comm);
 } // namespace kagen
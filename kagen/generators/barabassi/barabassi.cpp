@@ -54,7 +54,7 @@ Barabassi::Barabassi(const PGeneratorConfig& config, const PEID rank, const PEID
 
 void Barabassi::FinalizeEdgeList(MPI_Comm comm) {
     if (!config_.directed) {
-        AddReverseEdges(edges_, vertex_range_, comm);
+        AddReverseEdges(edges_, vertex_range_, config_.exchange_strategy, comm, spilled_edges_.get());
     }
 }
 
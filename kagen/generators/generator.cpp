@@ -2,19 +2,47 @@
 #include "kagen/context.h"
 #include "kagen/definitions.h"
 #include "kagen/tools/converter.h"
+#include "kagen/tools/radix_sort.h"
 
 #include <mpi.h>
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <utility>
 
 namespace kagen {
+EdgeSink::~EdgeSink() = default;
+
+void EdgeSink::Finish(VertexRange) {}
+
 Generator::~Generator() = default;
 
+void Generator::SetEdgeSink(EdgeSink* sink, const SInt buffer_size) {
+    edge_sink_        = sink;
+    edge_buffer_size_ = (sink != nullptr) ? std::max<SInt>(buffer_size, 1) : spill_buffer_size_;
+}
+
+void Generator::SetMemoryLimit(const SInt memory_limit, std::string scratch_directory, MPI_Comm comm) {
+    spill_buffer_size_ = (memory_limit > 0) ? std::max<SInt>(memory_limit / sizeof(EdgeList::value_type), 1)
+                                            : std::numeric_limits<SInt>::max();
+    scratch_directory_ = std::move(scratch_directory);
+    scratch_comm_      = comm;
+    if (edge_sink_ == nullptr) {
+        edge_buffer_size_ = spill_buffer_size_;
+    }
+}
+
 void Generator::Generate(const GraphRepresentation representation) {
     Reset();
 
     representation_ = representation;
+    if (edge_sink_ != nullptr) {
+        edges_.reserve(edge_buffer_size_);
+    } else if (spill_buffer_size_ != std::numeric_limits<SInt>::max()) {
+        spilled_edges_    = CreateExternalEdgeList<EdgeList::value_type>();
+        edge_buffer_size_ = spill_buffer_size_;
+    }
 
     switch (representation_) {
         case GraphRepresentation::EDGE_LIST:
@@ -25,9 +53,20 @@ void Generator::Generate(const GraphRepresentation representation) {
             GenerateCSR();
             break;
     }
+
+    if (edge_sink_ != nullptr) {
+        FlushEdges();
+        edge_sink_->Finish(vertex_range_);
+    }
 }
 
 void Generator::Finalize(MPI_Comm comm) {
+    // Edges pushed from now on are kept in memory, whereas spilled edges stay on disk: generators that exchange edges
+    // during finalization stream them into the exchange, all other generators get them merged back afterwards
+    if (edge_sink_ == nullptr) {
+        edge_buffer_size_ = std::numeric_limits<SInt>::max();
+    }
+
     switch (representation_) {
         case GraphRepresentation::EDGE_LIST:
             FinalizeEdgeList(comm);
@@ -37,6 +76,8 @@ void Generator::Finalize(MPI_Comm comm) {
             FinalizeCSR(comm);
             break;
     }
+
+    MergeSpilledEdges();
 }
 
 void Generator::FinalizeEdgeList(MPI_Comm) {}
@@ -78,6 +119,7 @@ void EdgeListOnlyGenerator::FinalizeCSR(MPI_Comm comm) {
     // Otherwise, we have generated the graph in edge list representation, but
     // actually want CSR format --> transform graph
     FinalizeEdgeList(comm);
+    MergeSpilledEdges();
     std::tie(xadj_, adjncy_) = BuildCSRFromEdgeList(vertex_range_, edges_, edge_weights_);
     {
         EdgeList tmp;
@@ -85,11 +127,79 @@ void EdgeListOnlyGenerator::FinalizeCSR(MPI_Comm comm) {
     }
 }
 
+namespace {
+// Number of edges buffered between two calls of the edge sink used by TwoPassCSRGenerator
+constexpr SInt kTwoPassBufferSize = 1 << 12;
+} // namespace
+
+void TwoPassCSRGenerator::GenerateCSR() {
+    EdgeSink* const user_sink        = edge_sink_;
+    const SInt      user_buffer_size = edge_buffer_size_;
+
+    auto run_pass = [&](EdgeSink& sink) {
+        SetEdgeSink(&sink, kTwoPassBufferSize);
+        GenerateEdgeList();
+        FlushEdges();
+    };
+
+    // First pass: count the degree of each local vertex, shifted by one
+    CallbackEdgeSink count_degrees([&](const EdgeList& edges) {
+        if (xadj_.empty()) {
+            xadj_.resize(vertex_range_.second - vertex_range_.first + 1);
+        }
+        for (const auto& [from, to]: edges) {
+            ++xadj_[from - vertex_range_.first + 1];
+        }
+    });
+    run_pass(count_degrees);
+
+    const SInt num_local_nodes = vertex_range_.second - vertex_range_.first;
+    xadj_.resize(num_local_nodes + 1);
+    std::partial_sum(xadj_.begin(), xadj_.end(), xadj_.begin());
+    adjncy_.resize(xadj_.back());
+
+    // Vertex information is complete after the first pass: depending on the generator, it is either pushed again
+    // during the second pass (e.g., grids) or not at all, since the generator remembers which vertices it already
+    // generated (e.g., RGGs mark their cells as generated). Thus, keep the copy from the first pass.
+    Coordinates   coordinates    = std::exchange(coordinates_, {});
+    VertexWeights vertex_weights = std::exchange(vertex_weights_, {});
+
+    // Second pass: xadj_[u] is the next free slot in the neighborhood of u
+    CallbackEdgeSink place_edges([&](const EdgeList& edges) {
+        for (const auto& [from, to]: edges) {
+            adjncy_[xadj_[from - vertex_range_.first]++] = to;
+        }
+    });
+    run_pass(place_edges);
+
+    // Now, xadj_[u] points to the end of the neighborhood of u, i.e., the start of the neighborhood of u + 1
+    for (SInt u = num_local_nodes; u > 0; --u) {
+        xadj_[u] = xadj_[u - 1];
+    }
+    xadj_.front() = 0;
+
+    coordinates_    = std::move(coordinates);
+    vertex_weights_ = std::move(vertex_weights);
+
+    num_flushed_edges_ = 0;
+    edge_sink_         = user_sink;
+    edge_buffer_size_  = user_buffer_size;
+}
+
 SInt Generator::GetNumberOfEdges() const {
-    return std::max(adjncy_.size(), edges_.size());
+    const SInt num_spilled_edges = (spilled_edges_ != nullptr) ? spilled_edges_->GetNumberOfEdges() : 0;
+    return num_flushed_edges_ + num_spilled_edges + std::max(adjncy_.size(), edges_.size());
+}
+
+bool Generator::HasVertexIDOverflow() const {
+    constexpr SInt kMaxNumberOfVertices = static_cast<SInt>(std::numeric_limits<VertexID>::max()) + 1;
+    return vertex_id_overflow_ || (kMaxNumberOfVertices != 0 && vertex_range_.second > kMaxNumberOfVertices);
 }
 
 Graph Generator::Take() {
+    // Spilled edges are still on disk if the graph was not finalized; the returned graph is kept in memory
+    MergeSpilledEdges();
+
     return {
         vertex_range_,
         representation_,
@@ -106,12 +216,48 @@ void Generator::SetVertexRange(const VertexRange vertex_range) {
 }
 
 void Generator::FilterDuplicateEdges() {
-    std::sort(edges_.begin(), edges_.end());
-    auto it = std::unique(edges_.begin(), edges_.end());
-    edges_.erase(it, edges_.end());
+    if (std::is_sorted(edges_.begin(), edges_.end())) {
+        auto it = std::unique(edges_.begin(), edges_.end());
+        edges_.erase(it, edges_.end());
+    } else {
+        RadixSortAndDeduplicateEdges(edges_);
+    }
+}
+
+void Generator::FlushEdges() {
+    if (edges_.empty()) {
+        return;
+    }
+
+    // Truncated vertex IDs must not reach the edge sink; the error is reported once generation has finished
+    if (vertex_id_overflow_) {
+        edges_.clear();
+        return;
+    }
+
+    if (edge_sink_ != nullptr) {
+        num_flushed_edges_ += edges_.size();
+        edge_sink_->Consume(edges_);
+        edges_.clear();
+    } else if (spilled_edges_ != nullptr) {
+        spilled_edges_->WriteRun(edges_);
+    }
+}
+
+void Generator::MergeSpilledEdges() {
+    if (spilled_edges_ != nullptr) {
+        spilled_edges_->MergeInto(edges_);
+        spilled_edges_.reset();
+        if (edge_sink_ == nullptr) {
+            edge_buffer_size_ = std::numeric_limits<SInt>::max();
+        }
+    }
 }
 
 void Generator::Reset() {
+    num_flushed_edges_  = 0;
+    vertex_id_overflow_ = false;
+    spilled_edges_.reset();
     edges_.clear();
     xadj_.clear();
     adjncy_.clear();
@@ -134,6 +280,10 @@ GeneratorFactory::NormalizeParameters(PGeneratorConfig config, PEID, const PEID
     return config;
 }
 
+bool GeneratorFactory::IsCommunicationFree() const {
+    return false;
+}
+
 namespace {
 bool IsPowerOfTwo(const SInt value) {
     return (value & (value - 1)) == 0;
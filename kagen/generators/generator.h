@@ -2,24 +2,71 @@
 
 #include <cstdint>
 #include <exception>
+#include <limits>
 #include <memory>
+#include <utility>
 
 #include <mpi.h>
 
 #include "kagen/context.h"
 #include "kagen/definitions.h"
+#include "kagen/tools/external_edge_list.h"
 
 namespace kagen {
+// Consumer for edges that are streamed out of a generator chunk by chunk, see Generator::SetEdgeSink().
+class EdgeSink {
+public:
+    virtual ~EdgeSink();
+
+    // Called with the next batch of local edges. The sink may consume the edges (e.g., by moving from the buffer);
+    // the buffer is cleared afterwards and refilled by the generator.
+    virtual void Consume(EdgeList& edges) = 0;
+
+    // Called once after the last batch with the final vertex range of this PE.
+    virtual void Finish(VertexRange vertex_range);
+};
+
+// Edge sink that forwards each batch of edges to a user-provided callable, e.g., a lambda.
+template <typename Callback>
+class CallbackEdgeSink : public EdgeSink {
+public:
+    explicit CallbackEdgeSink(Callback callback) : callback_(std::move(callback)) {}
+
+    void Consume(EdgeList& edges) final {
+        callback_(static_cast<const EdgeList&>(edges));
+    }
+
+private:
+    Callback callback_;
+};
+
 class Generator {
 public:
     virtual ~Generator();
 
+    // If set, generated edges are not materialized: whenever `buffer_size` edges have been pushed, they are passed
+    // to `sink` and the buffer is reused. Only meaningful for generators that do not postprocess their edge list, see
+    // GeneratorFactory::IsCommunicationFree(). Pass nullptr to disable streaming.
+    void SetEdgeSink(EdgeSink* sink, SInt buffer_size);
+
+    // If `memory_limit` is nonzero, local edges that exceed `memory_limit` bytes during generation are written to
+    // sorted runs in `scratch_directory`; the rank in `comm` identifies the scratch files of this PE. Generators that
+    // exchange edges during finalization stream the runs into the exchange, all others merge them back into memory.
+    // Note that spilling sorts the local edges and removes duplicate edges. Generators that push edge weights reject
+    // a memory limit when their parameters are normalized.
+    virtual void SetMemoryLimit(SInt memory_limit, std::string scratch_directory, MPI_Comm comm);
+
     void Generate(GraphRepresentation representation);
 
     void Finalize(MPI_Comm comm);
 
     SInt GetNumberOfEdges() const;
 
+    // Whether a vertex ID pushed so far or the vertex range of this PE does not fit into VertexID, i.e., whether the
+    // graph requires 64 bit vertex IDs (see KAGEN_32BIT_VERTEX_IDS). Edges are not passed to the edge sink once this
+    // happened, since their IDs were truncated.
+    bool HasVertexIDOverflow() const;
+
     Graph Take();
 
 protected:
@@ -46,7 +93,13 @@ protected:
     }
 
     inline void PushEdge(const SInt from, const SInt to) {
+#ifdef KAGEN_32BIT_VERTEX_IDS
+        vertex_id_overflow_ |= (from | to) > std::numeric_limits<VertexID>::max();
+#endif // KAGEN_32BIT_VERTEX_IDS
         edges_.emplace_back(from, to);
+        if (edges_.size() >= edge_buffer_size_) {
+            FlushEdges();
+        }
     }
 
     inline void PushEdgeWeight(const SSInt weight) {
@@ -59,6 +112,17 @@ protected:
 
     void FilterDuplicateEdges();
 
+    // Creates an empty external edge list in the scratch directory set by SetMemoryLimit(), for generators that buffer
+    // local edges in their own format
+    template <typename Edge>
+    std::unique_ptr<ExternalEdgeList<Edge>> CreateExternalEdgeList() const {
+        return std::make_unique<ExternalEdgeList<Edge>>(scratch_directory_, scratch_comm_);
+    }
+
+    // Merges edges that were spilled to disk back into edges_, which is sorted and duplicate-free afterwards if any
+    // edges were spilled. Finalization steps that require all local edges in memory must call this first.
+    void MergeSpilledEdges();
+
     VertexRange   vertex_range_;
     EdgeList      edges_;
     XadjArray     xadj_;
@@ -67,10 +131,27 @@ protected:
     VertexWeights vertex_weights_;
     EdgeWeights   edge_weights_;
 
+    bool vertex_id_overflow_ = false;
+
+    // Edges spilled to disk during generation; still on disk during finalization
+    std::unique_ptr<SpilledEdgeList> spilled_edges_;
+
 private:
+    friend class TwoPassCSRGenerator;
+
     void Reset();
 
+    void FlushEdges();
+
     GraphRepresentation representation_;
+
+    EdgeSink* edge_sink_         = nullptr;
+    SInt      edge_buffer_size_  = std::numeric_limits<SInt>::max();
+    SInt      num_flushed_edges_ = 0;
+
+    SInt        spill_buffer_size_ = std::numeric_limits<SInt>::max();
+    std::string scratch_directory_;
+    MPI_Comm    scratch_comm_ = MPI_COMM_NULL;
 };
 
 class ConfigurationError : public std::exception {
@@ -91,6 +172,16 @@ public:
     void FinalizeCSR(MPI_Comm comm) final;
 };
 
+// Builds the CSR representation without materializing an edge list: the edge list generator is run twice, first to
+// count the degree of each local vertex, then to place each edge in its final position. Requires the generator to
+// (a) call SetVertexRange() before the first PushEdge(), (b) only push edges whose tail is a local vertex, (c) push the
+// same edges on every invocation of GenerateEdgeList() and (d) not push edge weights. Coordinates and vertex weights
+// are taken from the first invocation.
+class TwoPassCSRGenerator : virtual Generator {
+public:
+    void GenerateCSR() final;
+};
+
 class CSROnlyGenerator : virtual Generator {
 public:
     void GenerateEdgeList() final;
@@ -105,6 +196,10 @@ public:
 
     virtual std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const = 0;
 
+    // Whether the generated local edges are final right after generation, i.e., each PE generates its part of the
+    // graph independently and finalization is a no-op. Such generators can stream their edges to an EdgeSink.
+    virtual bool IsCommunicationFree() const;
+
 protected:
     void EnsureSquarePowerOfTwoChunkSize(PGeneratorConfig& config, PEID size, bool output) const;
     void EnsureCubicPowerOfTwoChunkSize(PGeneratorConfig& config, PEID size, bool output) const;
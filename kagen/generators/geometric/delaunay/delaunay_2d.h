@@ -12,7 +12,7 @@
 #include "kagen/generators/geometric/geometric_2d.h"
 
 namespace kagen {
-class Delaunay2D : public Geometric2D {
+class Delaunay2D : public Geometric2D, private EdgeListOnlyGenerator {
 public:
     Delaunay2D(const PGeneratorConfig& config, PEID rank, PEID size);
 
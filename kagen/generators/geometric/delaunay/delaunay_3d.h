@@ -11,7 +11,7 @@
 #include "kagen/generators/geometric/geometric_3d.h"
 
 namespace kagen {
-class Delaunay3D : public Geometric3D {
+class Delaunay3D : public Geometric3D, private EdgeListOnlyGenerator {
 public:
     Delaunay3D(const PGeneratorConfig& config, PEID rank, PEID size);
 
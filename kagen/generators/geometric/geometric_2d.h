@@ -23,7 +23,7 @@
 #include "libmorton/morton2D.h"
 
 namespace kagen {
-class Geometric2D : public virtual Generator, private EdgeListOnlyGenerator {
+class Geometric2D : public virtual Generator {
 public:
     // n, x_off, y_off, generated, offset
     using Chunk = std::tuple<SInt, LPFloat, LPFloat, bool, SInt>;
@@ -47,11 +47,12 @@ protected:
         for (SInt i = local_chunk_start_; i < local_chunk_end_; ++i)
             ComputeChunk(i);
 
+        // Vertex range is known once all local points are computed
+        SetVertexRange(start_node_, start_node_ + num_nodes_);
+
         // Generate local chunks and edges
         for (SInt i = local_chunk_start_; i < local_chunk_end_; ++i)
             GenerateChunk(i);
-
-        SetVertexRange(start_node_, start_node_ + num_nodes_);
     }
 
     // Config
@@ -24,7 +24,7 @@
 #include "libmorton/morton3D.h"
 
 namespace kagen {
-class Geometric3D : public virtual Generator, private EdgeListOnlyGenerator {
+class Geometric3D : public virtual Generator {
 public:
     // n, x_off, y_off, z_off, generated, offset
     using Chunk = std::tuple<SInt, LPFloat, LPFloat, LPFloat, bool, SInt>;
@@ -48,11 +48,17 @@ protected:
         for (SInt i = local_chunk_start_; i < local_chunk_end_; i++)
             ComputeChunk(i);
 
+        // Vertex range is known once all local points are computed
+        SetVertexRange(start_node_, start_node_ + num_nodes_);
+
+        // Generate local vertices before any edges: the edges of a chunk also generate the vertices of adjacent cells,
+        // which might belong to a later local chunk, without pushing their coordinates
+        for (SInt i = local_chunk_start_; i < local_chunk_end_; i++)
+            GenerateLocalVertices(i);
+
         // Generate local chunks and edges
         for (SInt i = local_chunk_start_; i < local_chunk_end_; i++)
             GenerateChunk(i);
-
-        SetVertexRange(start_node_, start_node_ + num_nodes_);
     }
 
     // Config
@@ -218,13 +224,17 @@ protected:
         }
     }
 
+    void GenerateLocalVertices(const SInt chunk_id) {
+        GenerateCells(chunk_id);
+        for (SInt i = 0; i < cells_per_chunk_; ++i)
+            GenerateVertices(chunk_id, i, true);
+    }
+
     void GenerateChunk(const SInt chunk_id) {
         SInt chunk_row, chunk_column, chunk_depth;
         Decode(chunk_id, chunk_column, chunk_row, chunk_depth);
         // Generate nodes, gather neighbors and add edges
-        GenerateCells(chunk_id);
-        for (SInt i = 0; i < cells_per_chunk_; ++i)
-            GenerateVertices(chunk_id, i, true);
+        GenerateLocalVertices(chunk_id);
         // Generate edges and vertices on demand
         GenerateEdges(chunk_row, chunk_column, chunk_depth);
     }
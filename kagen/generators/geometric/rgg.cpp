@@ -130,6 +130,10 @@ RGG2DFactory::Create(const PGeneratorConfig& config, const PEID rank, const PEID
     return std::make_unique<RGG2D>(config, rank, size);
 }
 
+bool RGG2DFactory::IsCommunicationFree() const {
+    return true;
+}
+
 PGeneratorConfig
 RGG3DFactory::NormalizeParameters(PGeneratorConfig config, PEID, const PEID size, const bool output) const {
     EnsureCubicPowerOfTwoChunkSize(config, size, output);
@@ -142,4 +146,8 @@ std::unique_ptr<Generator>
 RGG3DFactory::Create(const PGeneratorConfig& config, const PEID rank, const PEID size) const {
     return std::make_unique<RGG3D>(config, rank, size);
 }
+
+bool RGG3DFactory::IsCommunicationFree() const {
+    return true;
+}
 } // namespace kagen
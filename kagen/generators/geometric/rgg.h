@@ -10,6 +10,8 @@ public:
     PGeneratorConfig NormalizeParameters(PGeneratorConfig config, PEID rank, PEID size, bool output) const final;
 
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const final;
+
+    bool IsCommunicationFree() const final;
 };
 
 class RGG3DFactory : public GeneratorFactory {
@@ -17,5 +19,7 @@ public:
     PGeneratorConfig NormalizeParameters(PGeneratorConfig config, PEID rank, PEID size, bool output) const final;
 
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const final;
+
+    bool IsCommunicationFree() const final;
 };
 } // namespace kagen
@@ -12,7 +12,7 @@
 #include "kagen/generators/geometric/geometric_2d.h"
 
 namespace kagen {
-class RGG2D : public Geometric2D {
+class RGG2D : public Geometric2D, private TwoPassCSRGenerator {
 public:
     RGG2D(const PGeneratorConfig& config, PEID rank, PEID size);
 
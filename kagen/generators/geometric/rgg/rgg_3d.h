@@ -12,7 +12,7 @@
 #include "kagen/generators/geometric/geometric_3d.h"
 
 namespace kagen {
-class RGG3D : public Geometric3D {
+class RGG3D : public Geometric3D, private TwoPassCSRGenerator {
 public:
     RGG3D(const PGeneratorConfig& config, const PEID rank, const PEID size);
 
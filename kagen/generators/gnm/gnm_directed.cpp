@@ -6,6 +6,10 @@ GNMDirectedFactory::Create(const PGeneratorConfig& config, const PEID rank, cons
     return std::make_unique<GNMDirected>(config, rank, size);
 }
 
+bool GNMDirectedFactory::IsCommunicationFree() const {
+    return true;
+}
+
 GNMDirected::GNMDirected(const PGeneratorConfig& config, const PEID rank, const PEID size)
     : config_(config),
       rank_(rank),
@@ -25,13 +29,12 @@ void GNMDirected::GenerateEdgeList() {
 
     start_node_ = start_chunk * nodes_per_chunk + std::min(remaining_nodes, start_chunk);
     end_node_   = end_chunk * nodes_per_chunk + std::min(remaining_nodes, end_chunk);
-    num_nodes_  = end_node_ - start_node_ - 1;
+    num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     // Generate chunks
     for (SInt i = 0; i < num_chunks; i++)
         GenerateChunk(start_chunk++);
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 void GNMDirected::GenerateChunk(const SInt chunk_id) {
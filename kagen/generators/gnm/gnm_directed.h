@@ -18,9 +18,11 @@ namespace kagen {
 class GNMDirectedFactory : public GeneratorFactory {
 public:
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const override;
+
+    bool IsCommunicationFree() const override;
 };
 
-class GNMDirected : public virtual Generator, private EdgeListOnlyGenerator {
+class GNMDirected : public virtual Generator, private TwoPassCSRGenerator {
 public:
     GNMDirected(const PGeneratorConfig& config, PEID rank, PEID size);
 
@@ -9,6 +9,10 @@ GNMUndirectedFactory::Create(const PGeneratorConfig& config, const PEID rank, co
     return std::make_unique<GNMUndirectedBig>(config, rank, size);
 }
 
+bool GNMUndirectedFactory::IsCommunicationFree() const {
+    return true;
+}
+
 template <typename BigInt>
 GNMUndirected<BigInt>::GNMUndirected(const PGeneratorConfig& config, const PEID rank, const PEID size)
     : config_(config),
@@ -31,13 +35,12 @@ void GNMUndirected<BigInt>::GenerateEdgeList() {
     start_node_ = start_chunk * nodes_per_chunk_ + std::min(remaining_nodes_, start_chunk);
     end_node_   = end_chunk * nodes_per_chunk_ + std::min(remaining_nodes_, end_chunk);
     num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     for (SInt i = 0; i < num_chunks; i++) {
         GenerateChunks(row);
         row++;
     }
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 template <typename BigInt>
@@ -18,10 +18,12 @@ namespace kagen {
 class GNMUndirectedFactory : public GeneratorFactory {
 public:
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const override;
+
+    bool IsCommunicationFree() const override;
 };
 
 template <typename BigInt>
-class GNMUndirected : public virtual Generator, private EdgeListOnlyGenerator {
+class GNMUndirected : public virtual Generator, private TwoPassCSRGenerator {
 public:
     GNMUndirected(const PGeneratorConfig& config, PEID rank, PEID size);
 
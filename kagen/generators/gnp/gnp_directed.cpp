@@ -6,6 +6,10 @@ GNPDirectedFactory::Create(const PGeneratorConfig& config, const PEID rank, cons
     return std::make_unique<GNPDirected>(config, rank, size);
 }
 
+bool GNPDirectedFactory::IsCommunicationFree() const {
+    return true;
+}
+
 GNPDirected::GNPDirected(const PGeneratorConfig& config, const PEID rank, const PEID size)
     : config_(config),
       rank_(rank),
@@ -29,7 +33,8 @@ void GNPDirected::GenerateEdgeList() {
 
     start_node_ = start_chunk * nodes_per_chunk + std::min(start_chunk, remaining_nodes);
     end_node_   = end_chunk * nodes_per_chunk + std::min(end_chunk, remaining_nodes);
-    num_nodes_  = end_node_ - start_node_ - 1;
+    num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     // Generate chunks
     SInt current_node = start_node_;
@@ -38,8 +43,6 @@ void GNPDirected::GenerateEdgeList() {
         GenerateChunk(start_chunk++, current_node, nodes_for_chunk);
         current_node += nodes_for_chunk;
     }
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 void GNPDirected::GenerateChunk(const SInt chunk_id, const SInt node_id, const SInt n) {
@@ -18,9 +18,11 @@ namespace kagen {
 class GNPDirectedFactory : public GeneratorFactory {
 public:
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const override;
+
+    bool IsCommunicationFree() const override;
 };
 
-class GNPDirected : public virtual Generator, private EdgeListOnlyGenerator {
+class GNPDirected : public virtual Generator, private TwoPassCSRGenerator {
 public:
     GNPDirected(const PGeneratorConfig& config, PEID rank, PEID size);
 
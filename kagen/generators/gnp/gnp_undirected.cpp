@@ -8,6 +8,10 @@ GNPUndirectedFactory::Create(const PGeneratorConfig& config, const PEID rank, co
     return std::make_unique<GNPUndirected>(config, rank, size);
 }
 
+bool GNPUndirectedFactory::IsCommunicationFree() const {
+    return true;
+}
+
 GNPUndirected::GNPUndirected(const PGeneratorConfig& config, const PEID rank, const PEID size)
     : config_(config),
       rank_(rank),
@@ -27,6 +31,7 @@ void GNPUndirected::GenerateEdgeList() {
     start_node_ = start_chunk * nodes_per_chunk + std::min(remaining_nodes, start_chunk);
     end_node_   = end_chunk * nodes_per_chunk + std::min(remaining_nodes, end_chunk);
     num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     // Generate chunks
     for (SInt i = 0; i < num_chunks; i++) {
@@ -60,8 +65,6 @@ void GNPUndirected::GenerateEdgeList() {
             row_node_id += row_n;
         }
     }
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 void GNPUndirected::GenerateTriangleChunk(
@@ -18,9 +18,11 @@ namespace kagen {
 class GNPUndirectedFactory : public GeneratorFactory {
 public:
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const override;
+
+    bool IsCommunicationFree() const override;
 };
 
-class GNPUndirected : public virtual Generator, private EdgeListOnlyGenerator {
+class GNPUndirected : public virtual Generator, private TwoPassCSRGenerator {
 public:
     GNPUndirected(const PGeneratorConfig& config, PEID rank, PEID size);
 
@@ -1,23 +1,67 @@
 #include "kagen/generators/graph500_generator.h"
+#include "kagen/tools/radix_sort.h"
 
 #include <mpi.h>
 
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <type_traits>
 
 namespace kagen {
-Graph500Generator::Graph500Generator(const PGeneratorConfig& config) : config_(config) {}
+namespace {
+template <typename ID>
+MPI_Datatype CreateLocalEdgeType() {
+    MPI_Datatype edge_type;
+    MPI_Type_contiguous(2, std::is_same_v<ID, std::uint32_t> ? MPI_UINT32_T : MPI_UINT64_T, &edge_type);
+    MPI_Type_commit(&edge_type);
+    return edge_type;
+}
+} // namespace
+
+Graph500Generator::Graph500Generator(const PGeneratorConfig& config)
+    : config_(config),
+      spill_buffer_size_(std::numeric_limits<SInt>::max()) {
+    // 32 bit vertex IDs suffice for up to 2^32 vertices, which halves the memory of the local edge buffer
+    const SInt log_n = std::log2(config_.n);
+    use_64bit_ids_   = log_n > 32;
+
+    // Local edges are only exchanged during finalization, spill them to disk if they exceed the memory limit
+    if (config_.memory_limit > 0) {
+        const SInt edge_size = use_64bit_ids_ ? sizeof(LocalEdge<std::uint64_t>) : sizeof(LocalEdge<std::uint32_t>);
+        spill_buffer_size_   = std::max<SInt>(config_.memory_limit / edge_size, 2);
+    }
+}
 
 void Graph500Generator::FinalizeEdgeList(MPI_Comm comm) {
+    if (use_64bit_ids_) {
+        FinalizeEdgeList(local_edges64_, comm);
+    } else {
+        FinalizeEdgeList(local_edges32_, comm);
+    }
+}
+
+template <typename ID>
+void Graph500Generator::FinalizeEdgeList(LocalEdgeBuffer<ID>& buffer, MPI_Comm comm) {
     const SInt log_n = std::log2(config_.n);
     const SInt n     = 1ull << log_n;
-    { // Remove local duplicates
-        std::sort(local_edges_.begin(), local_edges_.end());
-        auto it = std::unique(local_edges_.begin(), local_edges_.end());
-        local_edges_.erase(it, local_edges_.end());
+    // Remove local duplicates: spilled edges are streamed from their runs, which are merged on the fly, instead of
+    // being merged back into memory next to the send buffer
+    const bool spilled = buffer.spilled != nullptr && !buffer.spilled->IsEmpty();
+    if (spilled) {
+        buffer.spilled->WriteRun(buffer.edges);
+    } else {
+        RadixSortAndDeduplicateEdges(buffer.edges);
     }
+    auto for_each_local_edge = [&](auto&& consume) {
+        if (spilled) {
+            buffer.spilled->ForEachEdge(consume);
+        } else {
+            std::for_each(buffer.edges.begin(), buffer.edges.end(), consume);
+        }
+    };
 
     PEID size;
     PEID rank;
@@ -25,44 +69,42 @@ void Graph500Generator::FinalizeEdgeList(MPI_Comm comm) {
     MPI_Comm_rank(comm, &rank);
 
     // Remove vertex distribution (round-robin)
-    const int num_vertices_per_pe = n / size;
-    const int remaining_vertices  = n % size;
+    const SInt num_vertices_per_pe = n / size;
+    const SInt remaining_vertices  = n % size;
 
-    std::vector<int> distribution(size + 1);
+    std::vector<SInt> distribution(size + 1);
     for (PEID pe = 0; pe < size; ++pe) {
-        distribution[pe] = num_vertices_per_pe + (pe < remaining_vertices);
+        distribution[pe] = num_vertices_per_pe + (static_cast<SInt>(pe) < remaining_vertices);
     }
-    std::exclusive_scan(distribution.begin(), distribution.end(), distribution.begin(), 0);
+    std::exclusive_scan(distribution.begin(), distribution.end(), distribution.begin(), static_cast<SInt>(0));
     distribution.back() = n;
 
     // Find number of edges for each PE
-    auto compute_owner = [&](const int id) {
-        return id % size;
+    auto compute_owner = [&](const SInt id) {
+        return static_cast<PEID>(id % size);
     };
-    auto compute_remap = [&](const int id) {
-        return distribution[compute_owner(id)] + id / size;
+    auto compute_remap = [&](const SInt id) {
+        return static_cast<ID>(distribution[compute_owner(id)] + id / size);
     };
 
     // Compute send_counts and send_displs
     std::vector<int> send_counts(size);
-    for (const auto& [u, v]: local_edges_) {
-        ++send_counts[compute_owner(u)];
-    }
+    for_each_local_edge([&](const auto& edge) { ++send_counts[compute_owner(std::get<0>(edge))]; });
     std::vector<int> send_displs(size);
     std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
 
-    // Remap edges and build send buffer
-    std::vector<long long> sendbuf(local_edges_.size());
-    std::vector<int>       sendbuf_pos(size);
-    for (const auto& [u, v]: local_edges_) {
+    // Remap edges and build send buffer, bucketed by the owner of the tail
+    std::vector<LocalEdge<ID>> sendbuf(send_displs.back() + send_counts.back());
+    std::vector<int>           sendbuf_pos(size);
+    for_each_local_edge([&](const auto& edge) {
+        const auto& [u, v] = edge;
         const PEID u_owner = compute_owner(u);
-        const int  u_prime = compute_remap(u);
-        const int  v_prime = compute_remap(v);
-
-        const auto index = send_displs[u_owner] + sendbuf_pos[u_owner];
-        sendbuf[index]   = (static_cast<long long>(u_prime) << 32) | static_cast<long long>(v_prime);
+        const auto index   = send_displs[u_owner] + sendbuf_pos[u_owner];
+        sendbuf[index]     = {compute_remap(u), compute_remap(v)};
         ++sendbuf_pos[u_owner];
-    }
+    });
+    { [[maybe_unused]] auto _clear = std::move(buffer.edges); }
+    buffer.spilled.reset();
 
     // Exchange send_counts + send_displs
     std::vector<int> recv_counts(size);
@@ -71,14 +113,15 @@ void Graph500Generator::FinalizeEdgeList(MPI_Comm comm) {
     std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
 
     // Exchange edges
-    std::vector<long long> recvbuf(recv_counts.back() + recv_displs.back());
+    std::vector<LocalEdge<ID>> recvbuf(recv_counts.back() + recv_displs.back());
+    MPI_Datatype               edge_type = CreateLocalEdgeType<ID>();
     MPI_Alltoallv(
-        sendbuf.data(), send_counts.data(), send_displs.data(), MPI_LONG_LONG, recvbuf.data(), recv_counts.data(),
-        recv_displs.data(), MPI_LONG_LONG, comm);
+        sendbuf.data(), send_counts.data(), send_displs.data(), edge_type, recvbuf.data(), recv_counts.data(),
+        recv_displs.data(), edge_type, comm);
+    MPI_Type_free(&edge_type);
+    { [[maybe_unused]] auto _clear = std::move(sendbuf); }
 
-    for (const auto& edge: recvbuf) {
-        const int u = edge >> 32;
-        const int v = edge & 0xFFFFFFFF;
+    for (const auto& [u, v]: recvbuf) {
         PushEdge(u, v);
     }
 
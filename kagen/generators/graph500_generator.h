@@ -1,9 +1,15 @@
 #pragma once
 
 #include "kagen/generators/generator.h"
+#include "kagen/tools/external_edge_list.h"
 
 #include <mpi.h>
 
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+
 namespace kagen {
 class Graph500Generator : public virtual Generator, private EdgeListOnlyGenerator {
 public:
@@ -12,17 +18,49 @@ public:
 protected:
     void FinalizeEdgeList(MPI_Comm comm) final;
 
-    inline void PushLocalEdge(const int from, const int to) {
+    inline void PushLocalEdge(const SInt from, const SInt to) {
+        if (use_64bit_ids_) {
+            PushLocalEdge(local_edges64_, from, to);
+        } else {
+            PushLocalEdge(local_edges32_, from, to);
+        }
+    }
+
+private:
+    template <typename ID>
+    using LocalEdge = std::tuple<ID, ID>;
+
+    // Local edges before the vertex IDs are remapped, stored with IDs that are just wide enough for the number of
+    // vertices
+    template <typename ID>
+    struct LocalEdgeBuffer {
+        std::vector<LocalEdge<ID>>                       edges;
+        std::unique_ptr<ExternalEdgeList<LocalEdge<ID>>> spilled;
+    };
+
+    template <typename ID>
+    inline void PushLocalEdge(LocalEdgeBuffer<ID>& buffer, const SInt from, const SInt to) {
         if (config_.self_loops || from != to) {
-            local_edges_.emplace_back(from, to);
+            buffer.edges.emplace_back(from, to);
         }
         if (!config_.directed && from != to) {
-            local_edges_.emplace_back(to, from);
+            buffer.edges.emplace_back(to, from);
+        }
+        if (buffer.edges.size() >= spill_buffer_size_) {
+            if (buffer.spilled == nullptr) {
+                buffer.spilled = CreateExternalEdgeList<LocalEdge<ID>>();
+            }
+            buffer.spilled->WriteRun(buffer.edges);
         }
     }
 
-private:
-    const PGeneratorConfig&           config_;
-    std::vector<std::tuple<int, int>> local_edges_;
+    template <typename ID>
+    void FinalizeEdgeList(LocalEdgeBuffer<ID>& buffer, MPI_Comm comm);
+
+    const PGeneratorConfig&        config_;
+    bool                           use_64bit_ids_;
+    LocalEdgeBuffer<std::uint32_t> local_edges32_;
+    LocalEdgeBuffer<std::uint64_t> local_edges64_;
+    SInt                           spill_buffer_size_;
 };
 } // namespace kagen
@@ -36,6 +36,10 @@ Grid2DFactory::Create(const PGeneratorConfig& config, const PEID rank, const PEI
     return std::make_unique<Grid2D>(config, rank, size);
 }
 
+bool Grid2DFactory::IsCommunicationFree() const {
+    return true;
+}
+
 Grid2D::Grid2D(const PGeneratorConfig& config, const PEID rank, const PEID size)
     : config_(config),
       rank_(rank),
@@ -71,20 +75,11 @@ void Grid2D::GenerateEdgeList() {
     start_node_ = OffsetForChunk(start_chunk);
     end_node_   = OffsetForChunk(end_chunk);
     num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     for (SInt i = 0; i < num_chunks; i++) {
         GenerateChunk(start_chunk + i);
     }
-
-    if (config_.coordinates) {
-        for (SInt y = 0; y < total_rows_; ++y) {
-            for (SInt x = 0; x < total_cols_; ++x) {
-                PushCoordinate(1.0 * x / total_cols_, 1.0 * y / total_rows_);
-            }
-        }
-    }
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 void Grid2D::GenerateChunk(const SInt chunk) {
@@ -93,6 +88,27 @@ void Grid2D::GenerateChunk(const SInt chunk) {
     for (SInt i = start_vertex; i < end_vertex; i++) {
         GenerateEdges(chunk, i);
     }
+
+    if (config_.coordinates) {
+        GenerateCoordinates(chunk);
+    }
+}
+
+void Grid2D::GenerateCoordinates(const SInt chunk) {
+    SInt chunk_row, chunk_col;
+    Decode(chunk, chunk_row, chunk_col);
+
+    // Vertices of a chunk are numbered row by row, starting at the chunk's offset
+    const SInt first_row = chunk_row * rows_per_chunk_ + std::min(chunk_row, remaining_rows_);
+    const SInt first_col = chunk_col * cols_per_chunk_ + std::min(chunk_col, remaining_cols_);
+    const SInt rows      = rows_per_chunk_ + (chunk_row < remaining_rows_);
+    const SInt cols      = cols_per_chunk_ + (chunk_col < remaining_cols_);
+
+    for (SInt local_row = 0; local_row < rows; ++local_row) {
+        for (SInt local_col = 0; local_col < cols; ++local_col) {
+            PushCoordinate(1.0 * (first_col + local_col) / total_cols_, 1.0 * (first_row + local_row) / total_rows_);
+        }
+    }
 }
 
 void Grid2D::GenerateEdges(const SInt chunk, const SInt vertex) {
@@ -10,6 +10,10 @@ Grid3DFactory::Create(const PGeneratorConfig& config, const PEID rank, const PEI
     return std::make_unique<Grid3D>(config, rank, size);
 }
 
+bool Grid3DFactory::IsCommunicationFree() const {
+    return true;
+}
+
 PGeneratorConfig
 Grid3DFactory::NormalizeParameters(PGeneratorConfig config, PEID, const PEID size, const bool output) const {
     EnsureCubicPowerOfTwoChunkSize(config, size, output);
@@ -78,22 +82,11 @@ void Grid3D::GenerateEdgeList() {
     start_node_ = OffsetForChunk(start_chunk);
     end_node_   = OffsetForChunk(end_chunk);
     num_nodes_  = end_node_ - start_node_;
+    SetVertexRange(start_node_, start_node_ + num_nodes_);
 
     for (SInt i = 0; i < num_chunks; i++) {
         GenerateChunk(start_chunk + i);
     }
-
-    if (config_.coordinates) {
-        for (SInt z = 0; z < total_z_; ++z) {
-            for (SInt y = 0; y < total_y_; ++y) {
-                for (SInt x = 0; x < total_x_; ++x) {
-                    PushCoordinate(1.0 * x / total_x_, 1.0 * y / total_y_, 1.0 * z / total_z_);
-                }
-            }
-        }
-    }
-
-    SetVertexRange(start_node_, start_node_ + num_nodes_);
 }
 
 void Grid3D::GenerateChunk(const SInt chunk) {
@@ -102,6 +95,33 @@ void Grid3D::GenerateChunk(const SInt chunk) {
     for (SInt i = start_vertex; i < end_vertex; i++) {
         GenerateEdges(chunk, i);
     }
+
+    if (config_.coordinates) {
+        GenerateCoordinates(chunk);
+    }
+}
+
+void Grid3D::GenerateCoordinates(const SInt chunk) {
+    SInt chunk_x, chunk_y, chunk_z;
+    Decode(chunk, chunk_x, chunk_y, chunk_z);
+
+    // Vertices of a chunk are numbered x-major, starting at the chunk's offset
+    const SInt first_x = chunk_x * x_per_chunk_ + std::min(chunk_x, remaining_x_);
+    const SInt first_y = chunk_y * y_per_chunk_ + std::min(chunk_y, remaining_y_);
+    const SInt first_z = chunk_z * z_per_chunk_ + std::min(chunk_z, remaining_z_);
+    const SInt xs      = x_per_chunk_ + (chunk_x < remaining_x_);
+    const SInt ys      = y_per_chunk_ + (chunk_y < remaining_y_);
+    const SInt zs      = z_per_chunk_ + (chunk_z < remaining_z_);
+
+    for (SInt local_z = 0; local_z < zs; ++local_z) {
+        for (SInt local_y = 0; local_y < ys; ++local_y) {
+            for (SInt local_x = 0; local_x < xs; ++local_x) {
+                PushCoordinate(
+                    1.0 * (first_x + local_x) / total_x_, 1.0 * (first_y + local_y) / total_y_,
+                    1.0 * (first_z + local_z) / total_z_);
+            }
+        }
+    }
 }
 
 void Grid3D::GenerateEdges(const SInt chunk, const SInt vertex) {
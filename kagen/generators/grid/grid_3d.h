@@ -18,9 +18,11 @@ public:
     PGeneratorConfig NormalizeParameters(PGeneratorConfig config, PEID rank, PEID size, bool output) const final;
 
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const final;
+
+    bool IsCommunicationFree() const final;
 };
 
-class Grid3D : public virtual Generator, private EdgeListOnlyGenerator {
+class Grid3D : public virtual Generator, private TwoPassCSRGenerator {
 public:
     Grid3D(const PGeneratorConfig& config, PEID rank, PEID size);
 
@@ -48,6 +50,8 @@ private:
 
     void GenerateChunk(SInt chunk);
 
+    void GenerateCoordinates(SInt chunk);
+
     void GenerateEdges(SInt chunk, SInt vertex);
 
     void QueryInDirection(SInt chunk, SInt vertex, Direction direction);
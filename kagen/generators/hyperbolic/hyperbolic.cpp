@@ -118,7 +118,7 @@ Hyperbolic<Double>::Hyperbolic(const PGeneratorConfig& config, const PEID rank,
 
 template <typename Double>
 void Hyperbolic<Double>::FinalizeEdgeList(MPI_Comm comm) {
-    AddReverseEdges(edges_, vertex_range_, comm);
+    AddReverseEdges(edges_, vertex_range_, config_.exchange_strategy, comm, spilled_edges_.get());
 }
 
 template <typename Double>
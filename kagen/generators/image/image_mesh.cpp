@@ -20,6 +20,11 @@ PGeneratorConfig
 ImageMeshFactory::NormalizeParameters(PGeneratorConfig config, PEID, const PEID size, const bool output) const {
     ImageMeshConfig& iconfig = config.image_mesh;
 
+    // Spilled edges are sorted and deduplicated, which would separate them from their edge weights
+    if (config.memory_limit > 0) {
+        throw ConfigurationError("memory limit is not supported for image meshes, since they have edge weights");
+    }
+
     {
         bool exists = false;
         bool kargb  = false;
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include <assert.h>
 #include <stdint.h>
@@ -16,6 +19,10 @@
 #endif
 #include <inttypes.h>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 /* Initiator settings: for faster random number generation, the initiator
  * probabilities are defined as fractions (a = INITIATOR_A_NUMERATOR /
  * INITIATOR_DENOMINATOR, b = c = INITIATOR_BC_NUMERATOR /
@@ -52,36 +59,75 @@ Kronecker::Kronecker(const PGeneratorConfig& config, const PEID rank, const PEID
 }
 
 void Kronecker::GenerateEdgeList() {
+    // The scrambling permutation must be the same on all PEs, thus it only depends on the seed
+    {
+        uint_fast32_t scramble_seed[5];
+        make_mrg_seed(sampling::Spooky::hash(config_.seed + 1), sampling::Spooky::hash(config_.seed), scramble_seed);
+
+        mrg_state scramble_state;
+        mrg_seed(&scramble_state, scramble_seed);
+        mrg_skip(&scramble_state, 50, 7, 0);
+        scramble1_ = mrg_get_uint_orig(&scramble_state);
+        scramble1_ *= UINT64_C(0xFFFFFFFF);
+        scramble1_ += mrg_get_uint_orig(&scramble_state);
+        scramble2_ = mrg_get_uint_orig(&scramble_state);
+        scramble2_ *= UINT64_C(0xFFFFFFFF);
+        scramble2_ += mrg_get_uint_orig(&scramble_state);
+    }
+
     uint_fast32_t seed[5];
     make_mrg_seed(sampling::Spooky::hash((config_.seed + 1) * size_), sampling::Spooky::hash(rank_), seed);
 
     mrg_state state;
-
     mrg_seed(&state, seed);
 
-    [[maybe_unused]] uint64_t scramble1_, scramble2_; /* Values for scrambling */
-    {
-        mrg_state new_state = state;
-        mrg_skip(&new_state, 50, 7, 0);
-        scramble1_ = mrg_get_uint_orig(&new_state);
-        scramble1_ *= UINT64_C(0xFFFFFFFF);
-        scramble1_ += mrg_get_uint_orig(&new_state);
-        scramble2_ = mrg_get_uint_orig(&new_state);
-        scramble2_ *= UINT64_C(0xFFFFFFFF);
-        scramble2_ += mrg_get_uint_orig(&new_state);
-    }
+#ifdef _OPENMP
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+
+    // Edge i is generated from the state skipped ahead by i * 2^64 steps. Each thread generates a contiguous range of
+    // edges into a private buffer; buffers are appended in thread order, thus the result does not depend on the number
+    // of threads. Edges are generated in rounds to bound the size of the buffers.
+    std::vector<std::vector<std::pair<int64_t, int64_t>>> thread_edges(num_threads);
+
+    const SInt edges_per_round = static_cast<SInt>(num_threads) * kEdgesPerThreadAndRound;
 
+    for (SInt round_begin = 0; round_begin < num_edges_; round_begin += edges_per_round) {
+        const SInt round_size = std::min(edges_per_round, num_edges_ - round_begin);
+
+#ifdef _OPENMP
+    #pragma omp parallel num_threads(num_threads)
+#endif
+        {
 #ifdef _OPENMP
-    #pragma omp parallel for
+            const int thread = omp_get_thread_num();
+#else
+            const int thread = 0;
 #endif
-    for (SInt i = 0; i < num_edges_; ++i) {
-        mrg_state new_state = state;
-        mrg_skip(&new_state, 0, (uint64_t)i, 0);
-        GenerateEdge(config_.n, 0, &new_state);
+            const SInt begin = round_begin + round_size * thread / num_threads;
+            const SInt end   = round_begin + round_size * (thread + 1) / num_threads;
+
+            mrg_state stream = state;
+            mrg_skip(&stream, 0, begin, 0);
+            for (SInt i = begin; i < end; ++i) {
+                mrg_state edge_state = stream;
+                thread_edges[thread].push_back(GenerateEdge(config_.n, 0, &edge_state));
+                mrg_skip(&stream, 0, 1, 0);
+            }
+        }
+
+        for (auto& edges: thread_edges) {
+            for (const auto& [u, v]: edges) {
+                PushLocalEdge(u, v);
+            }
+            edges.clear();
+        }
     }
 }
 
-int Kronecker::Bernoulli(mrg_state* st, int level, int nlevels) {
+int Kronecker::Bernoulli(mrg_state* st, int level, int nlevels) const {
 #if SPK_NOISE_LEVEL == 0
     /* Avoid warnings */
     (void)level;
@@ -128,7 +174,7 @@ int Kronecker::Bernoulli(mrg_state* st, int level, int nlevels) {
 /* Reverse bits in a number; this should be optimized for performance
  * (including using bit- or byte-reverse intrinsics if your platform has them).
  * */
-inline uint64_t Kronecker::bitreverse(uint64_t x) {
+inline uint64_t Kronecker::bitreverse(uint64_t x) const {
 #if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3)
     #define USE_GCC_BYTESWAP /* __builtin_bswap* are in 4.3 but not 4.2 */
 #endif
@@ -175,7 +221,7 @@ inline uint64_t Kronecker::bitreverse(uint64_t x) {
 
 /* Apply a permutation to scramble vertex numbers; a randomly generated
  * permutation is not used because applying it at scale is too expensive. */
-inline int64_t Kronecker::Scramble(int64_t v0) {
+inline int64_t Kronecker::Scramble(int64_t v0) const {
     uint64_t v = (uint64_t)v0;
     v += scramble1_ + scramble2_;
     v *= (scramble1_ | UINT64_C(0x4519840211493211));
@@ -188,7 +234,7 @@ inline int64_t Kronecker::Scramble(int64_t v0) {
 }
 
 /* Make a single graph edge using a pre-set MRG state. */
-void Kronecker::GenerateEdge(int64_t n, int level, mrg_state* st) {
+std::pair<int64_t, int64_t> Kronecker::GenerateEdge(int64_t n, int level, mrg_state* st) const {
     int64_t base_src = 0, base_tgt = 0;
     while (n > 1) {
         int square     = Bernoulli(st, level, log_n_);
@@ -209,8 +255,6 @@ void Kronecker::GenerateEdge(int64_t n, int level, mrg_state* st) {
         base_tgt += n * tgt_offset;
     }
 
-    const auto u = Scramble(base_src);
-    const auto v = Scramble(base_tgt);
-    PushLocalEdge(u, v);
+    return {Scramble(base_src), Scramble(base_tgt)};
 }
 } // namespace kagen
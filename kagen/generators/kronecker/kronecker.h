@@ -11,6 +11,8 @@
 
 #include <sampling/hash.hpp>
 
+#include <utility>
+
 #include "kagen/context.h"
 #include "kagen/definitions.h"
 #include "kagen/generators/generator.h"
@@ -33,27 +35,30 @@ protected:
     void GenerateEdgeList() final;
 
 private:
+    // Number of edges generated by each thread before the edges are moved to the local edge list
+    static constexpr SInt kEdgesPerThreadAndRound = 1 << 16;
+
     // Config
     const PGeneratorConfig& config_;
     PEID                    size_, rank_;
 
     // Constants and variables
-    int     log_n_;
-    SInt    num_edges_;
-    int64_t scramble1_, scramble2_;
+    int      log_n_;
+    SInt     num_edges_;
+    uint64_t scramble1_, scramble2_;
 
-    int Bernoulli(mrg_state* st, int level, int nlevels);
+    int Bernoulli(mrg_state* st, int level, int nlevels) const;
 
     /* Reverse bits in a number; this should be optimized for performance
      * (including using bit- or byte-reverse intrinsics if your platform has them).
      * */
-    uint64_t bitreverse(uint64_t x);
+    uint64_t bitreverse(uint64_t x) const;
 
     /* Apply a permutation to scramble vertex numbers; a randomly generated
      * permutation is not used because applying it at scale is too expensive. */
-    int64_t Scramble(int64_t v0);
+    int64_t Scramble(int64_t v0) const;
 
     /* Make a single graph edge using a pre-set MRG state. */
-    void GenerateEdge(int64_t n, int level, mrg_state* st);
+    std::pair<int64_t, int64_t> GenerateEdge(int64_t n, int level, mrg_state* st) const;
 };
 } // namespace kagen
@@ -18,9 +18,10 @@ RMATFactory::NormalizeParameters(PGeneratorConfig config, PEID, const PEID size,
         throw ConfigurationError("sum of probabilities may not be larger than 1");
     }
 
+    // Paths of 128 bits hold two vertex IDs with up to 56 bits, see RMAT::GenerateEdgeList()
     const SInt log_n = std::log2(config.n);
-    if (log_n > 31) {
-        throw ConfigurationError("number of vertices is too large (cannot be larger than 31 bits)");
+    if (log_n > 56) {
+        throw ConfigurationError("number of vertices is too large (cannot be larger than 56 bits)");
     }
 
     if (output && config.n != 1ull << log_n) {
@@ -49,19 +50,27 @@ RMAT::RMAT(const PGeneratorConfig& config, const PEID rank, const PEID size)
 }
 
 void RMAT::GenerateEdgeList() {
-    using RNG  = rmat::generators::select_t;
-    using RMAT = rmat::rmat<false>;
+    using RNG = rmat::generators::select_t;
 
     const SInt seed  = rank_ + config_.seed;
     const SInt log_n = std::log2(config_.n);
     const SInt depth = std::min<SInt>(9, log_n);
 
-    RNG  gen(seed);
-    RNG  gen_scramble(seed + 1000);
-    RMAT r(gen_scramble, log_n, config_.rmat_a, config_.rmat_b, config_.rmat_c);
-    r.init(depth);
+    RNG gen(seed);
+    RNG gen_scramble(seed + 1000);
 
     // Generate local edges
-    r.get_edges([&](const auto u, const auto v) { PushLocalEdge(u, v); }, num_edges_, gen);
+    auto generate = [&](auto&& r) {
+        r.init(depth);
+        r.get_edges([&](const auto u, const auto v) { PushLocalEdge(u, v); }, num_edges_, gen);
+    };
+
+    // Each half of a path holds up to log_n + depth - 1 bits; only use 128 bit paths if 64 bits are not sufficient
+    if (log_n + depth - 1 <= 32) {
+        generate(rmat::rmat<false>(gen_scramble, log_n, config_.rmat_a, config_.rmat_b, config_.rmat_c));
+    } else {
+        generate(rmat::rmat<false, rmat::uint128_t>(
+            gen_scramble, log_n, config_.rmat_a, config_.rmat_b, config_.rmat_c));
+    }
 }
 } // namespace kagen
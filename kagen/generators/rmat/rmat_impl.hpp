@@ -62,12 +62,17 @@ struct rmat_stats_t<true> {
     tlx::Aggregate<double> bits_per_sample;
 };
 
-template <bool Scramble_IDs = false>
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Each path stores the bits of the source and destination vertex in its upper and lower half, respectively. Besides
+// log_n bits, each half must have room for the depth - 1 leftover bits of the previous table lookup; use uint128_t as
+// Path if uint64_t is too narrow. Path values are truncated to 64 bits in debug output.
+template <bool Scramble_IDs = false, typename Path = uint64_t>
 class rmat {
 public:
     using node   = int64_t;
     using prefix = uint32_t;
-    using path   = uint64_t;
+    using path   = Path;
     using edge   = std::pair<node, node>;
     using entry  = std::pair<prefix, double>;
 
@@ -87,7 +92,7 @@ public:
           node_mask((path{1} << log_n_) - 1),
           scramble_state(graph500::init_scramble_state(rng, log_n)) {
         sLOG << "RMAT: need" << 2 * log_n << "path bits";
-        sLOG << "RMAT: node extraction mask" << std::hex << node_mask;
+        sLOG << "RMAT: node extraction mask" << std::hex << static_cast<uint64_t>(node_mask);
     }
 
     void init(int max_depth) {
@@ -128,8 +133,9 @@ public:
             unsigned bits_in_prefix = split_prefix(next, src_part, dst_part);
 
             sLOG << "Prefix" << std::hex << next << "with" << std::dec << bits_in_prefix
-                 << "bits per half; src half:" << std::hex << src_part << "dst:" << dst_part
-                 << "old tentative result:" << result;
+                 << "bits per half; src half:" << std::hex << static_cast<uint64_t>(src_part)
+                 << "dst:" << static_cast<uint64_t>(dst_part)
+                 << "old tentative result:" << static_cast<uint64_t>(result);
 
             bits_per_half += bits_in_prefix;
             result <<= bits_in_prefix;
@@ -138,12 +144,12 @@ public:
         } while (bits_per_half < log_n);
         // remove unneeded bits
         unsigned shift = bits_per_half - log_n;
-        sLOG << "got enough bits in" << std::hex << result << "-- removing" << std::dec << shift << "of"
-             << bits_per_half;
+        sLOG << "got enough bits in" << std::hex << static_cast<uint64_t>(result) << "-- removing" << std::dec << shift
+             << "of" << bits_per_half;
         result >>= shift;
         node src = static_cast<node>(result >> path_half_bits);
         node dst = static_cast<node>(result & node_mask);
-        sLOG << "Extracted nodes" << std::hex << src << dst << "from" << result;
+        sLOG << "Extracted nodes" << std::hex << src << dst << "from" << static_cast<uint64_t>(result);
         stats.record_edge_done();
 
         if constexpr (scramble_ids) {
@@ -172,8 +178,9 @@ public:
             unsigned bits_in_prefix = split_prefix(next, src_part, dst_part);
 
             sLOG << "Prefix" << std::hex << next << "with" << std::dec << bits_in_prefix
-                 << "bits per half; src half:" << std::hex << src_part << "dst:" << dst_part
-                 << "old tentative result:" << result;
+                 << "bits per half; src half:" << std::hex << static_cast<uint64_t>(src_part)
+                 << "dst:" << static_cast<uint64_t>(dst_part)
+                 << "old tentative result:" << static_cast<uint64_t>(result);
 
             bits_per_half += bits_in_prefix;
             result <<= bits_in_prefix;
@@ -181,14 +188,14 @@ public:
             result |= dst_part;
 
             if (bits_per_half >= log_n) {
-                sLOG << "got enough bits in" << std::hex << result << "-- have" << std::dec << bits_per_half << "need"
-                     << log_n;
+                sLOG << "got enough bits in" << std::hex << static_cast<uint64_t>(result) << "-- have" << std::dec
+                     << bits_per_half << "need" << log_n;
                 // we have enough bits for an edge, extract it
                 int  excess = bits_per_half - log_n;
                 path tmp = (result >> excess), removal_mask = (path{1} << excess) - 1;
                 node src = (tmp >> path_half_bits), dst = tmp & node_mask;
 
-                sLOG << "Extracted nodes" << std::hex << src << dst << "from" << result;
+                sLOG << "Extracted nodes" << std::hex << src << dst << "from" << static_cast<uint64_t>(result);
                 // implement clip-and-flip
     #ifdef RMAT_CLIPFLIP
                 if (src > dst)
@@ -207,7 +214,8 @@ public:
                 // Reuse the remaining `leftover` bits
                 bits_per_half -= log_n;
                 result &= removal_mask;
-                sLOG << bits_per_half << "bits remaining, tentative result:" << std::hex << result;
+                sLOG << bits_per_half << "bits remaining, tentative result:" << std::hex
+                     << static_cast<uint64_t>(result);
             }
         }
     }
@@ -1,7 +1,7 @@
 #include "kagen/generators/static/binary_parhip.h"
 
-#include <array>
-#include <fstream>
+#include <cstring>
+#include <limits>
 
 #include "kagen/definitions.h"
 
@@ -10,42 +10,37 @@ namespace {
 using ParHipID     = unsigned long long;
 using ParHipWeight = SSInt;
 
-SInt OffsetToEdge(const SInt n, const SInt offset) {
-    return (offset / sizeof(ParHipID)) - 3 - (n + 1);
-}
-
-SInt ReadFirstEdge(std::ifstream& in, const SInt n, const SInt u) {
-    const SInt offset = (3 + u) * sizeof(ParHipID);
-    in.seekg(static_cast<std::streamsize>(offset));
-
-    ParHipID entry = 0;
-    in.read(reinterpret_cast<char*>(&entry), sizeof(ParHipID));
-
-    return OffsetToEdge(n, entry);
-}
+constexpr SInt kHeaderSize = 3;
 
+// See BinaryParHipWriter: the version is the negated format code of the Metis format
 bool HasVertexWeights(const SInt version) {
-    return ~(version & 2);
+    return (version & 2) == 0;
 }
 
 bool HasEdgeWeights(const SInt version) {
-    return ~(version & 1);
-}
-
-template <typename T>
-std::vector<T> ReadVector(std::ifstream& in, const SInt length) {
-    std::vector<T> ans(length);
-    in.read(reinterpret_cast<char*>(ans.data()), length * sizeof(T));
-    return ans;
+    return (version & 1) == 0;
 }
 } // namespace
 
-BinaryParhipReader::BinaryParhipReader(const std::string& filename) : in_(filename) {
-    std::array<ParHipID, 3> size;
-    in_.read(reinterpret_cast<char*>(size.data()), 3 * sizeof(ParHipID));
-    version_ = size[0];
-    n_       = size[1];
-    m_       = size[2];
+BinaryParhipReader::BinaryParhipReader(const std::string& filename) : file_(filename) {
+    if (file_.Length() < kHeaderSize * sizeof(ParHipID)) {
+        throw IOError("input file is too small for a binary ParHiP graph");
+    }
+
+    ParHipID header[kHeaderSize];
+    std::memcpy(header, file_.Data(), sizeof(header));
+    version_ = header[0];
+    n_       = header[1];
+    m_       = header[2];
+
+    const SInt num_weights = (HasVertexWeights(version_) ? n_ : 0) + (HasEdgeWeights(version_) ? m_ : 0);
+    const SInt num_ids     = kHeaderSize + n_ + 1 + m_;
+    if (version_ > 3 || num_ids * sizeof(ParHipID) + num_weights * sizeof(ParHipWeight) > file_.Length()) {
+        throw IOError("invalid or unsupported binary ParHiP graph format");
+    }
+    if (n_ > std::numeric_limits<VertexID>::max()) {
+        throw IOError("graph has too many vertices for the configured vertex ID width");
+    }
 }
 
 GraphSize BinaryParhipReader::ReadSize() {
@@ -58,82 +53,71 @@ Graph BinaryParhipReader::Read(
         to_node = FindNodeByEdge(to_edge);
     }
 
-    // Read xadj array of the CSR representation
     const SInt num_local_nodes = to_node - from;
-    in_.seekg((3 + from) * sizeof(ParHipID));
-    auto xadj = ReadVector<ParHipID>(in_, num_local_nodes + 1);
-
-    const SInt first_edge_offset = xadj.front();
-    for (auto& entry: xadj) { // Transform file offsets to edge offsets
-        entry = (entry - first_edge_offset) / sizeof(ParHipID);
+    const SInt first_edge      = ReadFirstEdge(from);
+    const SInt num_local_edges = ReadFirstEdge(to_node) - first_edge;
+
+    // Transform file offsets to edge offsets relative to the first local edge
+    const auto* offsets           = reinterpret_cast<const ParHipID*>(file_.Data()) + kHeaderSize;
+    const SInt  first_edge_offset = offsets[from];
+    XadjArray   xadj(num_local_nodes + 1);
+#pragma omp parallel for
+    for (SInt u = 0; u <= num_local_nodes; ++u) {
+        xadj[u] = (offsets[from + u] - first_edge_offset) / sizeof(ParHipID);
     }
 
-    // Read adjncy array
-    const SInt num_local_edges = xadj.back();
-    in_.seekg(first_edge_offset);
-    auto adjncy = ReadVector<ParHipID>(in_, num_local_edges);
-
     Graph ans;
-    ans.vertex_range   = {from, from + num_local_nodes};
+    ans.vertex_range   = {from, to_node};
     ans.representation = representation;
 
-    // Build edge list array from xadj and adjncy
+    const auto* adjncy = reinterpret_cast<const ParHipID*>(file_.Data()) + kHeaderSize + n_ + 1 + first_edge;
     if (representation == GraphRepresentation::EDGE_LIST) {
-        ans.edges.reserve(num_local_edges);
+        ans.edges.resize(num_local_edges);
+#pragma omp parallel for schedule(dynamic, 1024)
         for (SInt u = 0; u < num_local_nodes; ++u) {
-            const SInt first_edge         = xadj[u];
-            const SInt first_invalid_edge = xadj[u + 1];
-            for (SInt e = first_edge; e < first_invalid_edge; ++e) {
-                const SInt v = adjncy[e];
-                ans.edges.emplace_back(from + u, v);
+            for (SInt e = xadj[u]; e < xadj[u + 1]; ++e) {
+                ans.edges[e] = {from + u, static_cast<VertexID>(adjncy[e])};
             }
         }
     } else {
-        ans.xadj   = std::move(xadj);
-        ans.adjncy = std::move(adjncy);
+        ans.adjncy.resize(num_local_edges);
+        ConvertArray(adjncy, num_local_edges, ans.adjncy.data());
+        ans.xadj = std::move(xadj);
     }
 
-    // Load weights if the graph is weighted
+    // Vertex weights follow the adjacency array, edge weights follow the vertex weights (if any)
+    const char* weights = file_.Data() + (kHeaderSize + n_ + 1 + m_) * sizeof(ParHipID);
     if (HasVertexWeights(version_)) {
         ans.vertex_weights.resize(num_local_nodes);
-
-        const SInt offset = (3 + n_ + m_ + from) * sizeof(ParHipID);
-        in_.seekg(offset);
-        in_.read(reinterpret_cast<char*>(ans.vertex_weights.data()), num_local_nodes * sizeof(ParHipWeight));
+        ConvertArray(reinterpret_cast<const ParHipWeight*>(weights) + from, num_local_nodes, ans.vertex_weights.data());
+        weights += n_ * sizeof(ParHipWeight);
     }
     if (HasEdgeWeights(version_)) {
         ans.edge_weights.resize(num_local_edges);
-
-        SInt offset = first_edge_offset + m_ * sizeof(ParHipID);
-        if (HasVertexWeights(version_)) {
-            offset += n_ * sizeof(ParHipID);
-        }
-        in_.seekg(offset);
-        in_.read(reinterpret_cast<char*>(ans.edge_weights.data()), num_local_edges * sizeof(ParHipWeight));
+        ConvertArray(
+            reinterpret_cast<const ParHipWeight*>(weights) + first_edge, num_local_edges, ans.edge_weights.data());
     }
 
     return ans;
 }
 
 SInt BinaryParhipReader::FindNodeByEdge(const SInt edge) {
-    if (edge == 0) {
-        return 0;
-    }
-
-    std::pair<SInt, SInt> low  = {0, 0};
-    std::pair<SInt, SInt> high = {n_, m_ - 1};
-    while (high.first - low.first > 1) {
-        std::pair<SInt, SInt> mid;
-        mid.first  = (low.first + high.first) / 2;
-        mid.second = ReadFirstEdge(in_, n_, mid.first);
-
-        if (mid.second < edge) {
-            low = mid;
+    // First vertex whose first edge is not before `edge`
+    SInt low  = 0;
+    SInt high = n_;
+    while (low < high) {
+        const SInt mid = low + (high - low) / 2;
+        if (ReadFirstEdge(mid) < edge) {
+            low = mid + 1;
         } else {
             high = mid;
         }
     }
+    return low;
+}
 
-    return high.first;
+SInt BinaryParhipReader::ReadFirstEdge(const SInt u) const {
+    const SInt offset = reinterpret_cast<const ParHipID*>(file_.Data())[kHeaderSize + u];
+    return offset / sizeof(ParHipID) - kHeaderSize - (n_ + 1);
 }
 } // namespace kagen::staticgraph
@@ -1,10 +1,12 @@
 #pragma once
 
-#include <fstream>
+#include <string>
 
 #include "kagen/generators/static/graph_reader.h"
+#include "kagen/generators/static/mapped_file.h"
 
 namespace kagen::staticgraph {
+// Reads graphs in ParHiP's binary format from a memory mapping of the file; see BinaryParHipWriter for the layout
 class BinaryParhipReader : public GraphReader {
 public:
     BinaryParhipReader(const std::string& filename);
@@ -16,7 +18,10 @@ public:
     SInt FindNodeByEdge(SInt edge) final;
 
 private:
-    std::ifstream in_;
+    // Index of the first edge of vertex `u`, i.e., its entry in the offset array converted from a byte position
+    SInt ReadFirstEdge(SInt u) const;
+
+    MappedFile file_;
 
     SInt n_       = 0;
     SInt m_       = 0;
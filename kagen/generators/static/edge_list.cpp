@@ -0,0 +1,226 @@
+#include "kagen/generators/static/edge_list.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+#include "kagen/definitions.h"
+
+namespace kagen::staticgraph {
+namespace {
+struct Format {
+    SInt number_of_nodes = 0;
+    SInt body_start      = 0;
+};
+
+bool IsCommentChar(const char ch) {
+    return ch == '#' || ch == '%' || ch == 'c';
+}
+
+// Skips leading comments and parses the header "p <n> <m>" if there is one
+Format ParseHeader(MappedFileToker& toker) {
+    toker.Reset();
+    while (toker.ValidPosition()) {
+        const SInt line_start = toker.Position();
+        toker.SkipSpaces();
+
+        if (toker.TestChar('\n') || (toker.ValidPosition() && IsCommentChar(toker.Current()))) {
+            toker.SkipLine();
+        } else if (toker.ConsumeChar('p')) {
+            toker.SkipSpaces();
+            const SInt number_of_nodes = toker.ScanUnsigned();
+            toker.SkipLine();
+            return {number_of_nodes, toker.Position()};
+        } else {
+            return {0, line_start};
+        }
+    }
+    return {0, toker.Position()};
+}
+
+// Parses the edges whose lines start in [begin, end) of the body of the file, which starts at `body_start`
+EdgeList ParseEdges(MappedFileToker& toker, const SInt body_start, const SInt begin, const SInt end) {
+    // The line that contains `begin` belongs to the previous range, unless it starts at `begin`
+    toker.Seek(begin);
+    if (begin > body_start && begin < end && toker.Previous() != '\n') {
+        toker.SkipLine();
+    }
+
+    EdgeList edges;
+    while (toker.ValidPosition() && toker.Position() < end) {
+        toker.SkipSpaces();
+        if (toker.TestChar('\n') || (toker.ValidPosition() && IsCommentChar(toker.Current()))) {
+            toker.SkipLine();
+            continue;
+        }
+
+        // Lines "e <tail> <head>" use 1-based vertex IDs
+        const SInt offset = toker.ConsumeChar('e') ? 1 : 0;
+        toker.SkipSpaces();
+
+        if (!toker.ValidPosition() || !std::isdigit(toker.Current())) {
+            throw IOError("unexpected char in edge list");
+        }
+        const SInt tail = toker.ScanUnsigned();
+        if (!toker.ValidPosition() || !std::isdigit(toker.Current())) {
+            throw IOError("edge without head in edge list");
+        }
+        const SInt head = toker.ScanUnsigned();
+        if (tail < offset || head < offset) {
+            throw IOError("vertex IDs must start at 1 in lines starting with e");
+        }
+        if (std::max(tail, head) - offset > std::numeric_limits<VertexID>::max()) {
+            throw IOError("graph has too many vertices for the configured vertex ID width");
+        }
+
+        edges.emplace_back(tail - offset, head - offset);
+        toker.SkipLine();
+    }
+
+    return edges;
+}
+
+template <typename UInt>
+void ConvertEdges(const char* data, const SInt first_edge, EdgeList& edges) {
+    const UInt* ids = reinterpret_cast<const UInt*>(data) + 2 * first_edge;
+
+    if constexpr (sizeof(UInt) > sizeof(VertexID)) {
+        UInt max_id = 0;
+#pragma omp parallel for reduction(max : max_id)
+        for (SInt i = 0; i < 2 * edges.size(); ++i) {
+            max_id = std::max(max_id, ids[i]);
+        }
+        if (max_id > std::numeric_limits<VertexID>::max()) {
+            throw IOError("graph has too many vertices for the configured vertex ID width");
+        }
+    }
+
+#pragma omp parallel for
+    for (SInt e = 0; e < edges.size(); ++e) {
+        edges[e] = {static_cast<VertexID>(ids[2 * e]), static_cast<VertexID>(ids[2 * e + 1])};
+    }
+}
+} // namespace
+
+EdgeListReader::EdgeListReader(const std::string& filename) : filename_(filename), toker_(filename) {}
+
+EdgeListFragment EdgeListReader::ReadByteRange(const PEID rank, const PEID size) {
+    const auto [number_of_nodes, body_start] = ParseHeader(toker_);
+
+    const SInt body_length = toker_.Length() - body_start;
+    const SInt begin       = body_start + body_length * rank / size;
+    const SInt end         = body_start + body_length * (rank + 1) / size;
+
+    toker_.Prefetch(begin, end);
+
+    EdgeListFragment fragment;
+    fragment.num_vertices = number_of_nodes;
+
+#ifdef _OPENMP
+    const int num_threads = static_cast<int>(std::min<SInt>(omp_get_max_threads(), end - begin));
+#else
+    const int num_threads = 1;
+#endif
+    if (num_threads <= 1) {
+        fragment.edges = ParseEdges(toker_, body_start, begin, end);
+        return fragment;
+    }
+
+    // Same as for METIS files: each thread parses the lines that start in its part of the byte range with its own
+    // mapping of the file, and the edges are concatenated in thread order
+    std::vector<EdgeList>           thread_edges(num_threads);
+    std::vector<std::exception_ptr> errors(num_threads);
+#pragma omp parallel num_threads(num_threads)
+    {
+#ifdef _OPENMP
+        const int thread = omp_get_thread_num();
+#else
+        const int thread = 0;
+#endif
+        const SInt thread_begin = begin + (end - begin) * thread / num_threads;
+        const SInt thread_end   = begin + (end - begin) * (thread + 1) / num_threads;
+        try {
+            MappedFileToker toker(filename_);
+            thread_edges[thread] = ParseEdges(toker, body_start, thread_begin, thread_end);
+        } catch (...) {
+            errors[thread] = std::current_exception();
+        }
+    }
+    for (const auto& error: errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::vector<SInt> first_edge(num_threads + 1);
+    for (int thread = 0; thread < num_threads; ++thread) {
+        first_edge[thread + 1] = first_edge[thread] + thread_edges[thread].size();
+    }
+
+    fragment.edges.resize(first_edge.back());
+#pragma omp parallel for num_threads(num_threads)
+    for (int thread = 0; thread < num_threads; ++thread) {
+        auto& edges = thread_edges[thread];
+        std::copy(edges.begin(), edges.end(), fragment.edges.begin() + first_edge[thread]);
+        edges = {};
+    }
+
+    return fragment;
+}
+
+BinaryEdgeListReader::BinaryEdgeListReader(const std::string& filename, const int width)
+    : width_(width),
+      file_(filename) {
+    const std::size_t length = file_.Length();
+    if (length == 0) {
+        return;
+    }
+
+    // The header is optional, depending on --output-header; a file without header is only mistaken for one with a
+    // header if its first edges happen to encode the number of the remaining edges
+    const SInt edge_size   = 2 * static_cast<SInt>(width_) / 8;
+    const SInt header_size = 2 * sizeof(SInt);
+    SInt       header[2]   = {0, 0};
+    if (length >= header_size) {
+        std::memcpy(header, file_.Data(), header_size);
+    }
+
+    if (length >= header_size && (length - header_size) % edge_size == 0
+        && header[1] == (length - header_size) / edge_size) {
+        header_size_  = header_size;
+        num_vertices_ = header[0];
+        num_edges_    = header[1];
+        if (num_vertices_ > std::numeric_limits<VertexID>::max()) {
+            throw IOError("graph has too many vertices for the configured vertex ID width");
+        }
+    } else if (length % edge_size == 0) {
+        num_edges_ = length / edge_size;
+    } else {
+        throw IOError("size of the binary edge list is not a multiple of the size of an edge");
+    }
+}
+
+EdgeListFragment BinaryEdgeListReader::ReadByteRange(const PEID rank, const PEID size) {
+    const SInt first_edge = num_edges_ * rank / size;
+    const SInt last_edge  = num_edges_ * (rank + 1) / size;
+
+    EdgeListFragment fragment;
+    fragment.num_vertices = num_vertices_;
+    fragment.edges.resize(last_edge - first_edge);
+
+    if (width_ == 64) {
+        ConvertEdges<std::uint64_t>(file_.Data() + header_size_, first_edge, fragment.edges);
+    } else { // 32
+        ConvertEdges<std::uint32_t>(file_.Data() + header_size_, first_edge, fragment.edges);
+    }
+
+    return fragment;
+}
+} // namespace kagen::staticgraph
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+
+#include "kagen/generators/static/graph_reader.h"
+#include "kagen/generators/static/mapped_file.h"
+#include "kagen/generators/static/mmap_toker.h"
+
+namespace kagen::staticgraph {
+// Edges parsed by ReadByteRange(). `num_vertices` is the number of vertices recorded in the header of the file, or 0 if
+// the file has no header.
+struct EdgeListFragment {
+    EdgeList edges;
+    SInt     num_vertices = 0;
+};
+
+// Reads whitespace separated edge lists: either SNAP style files with one edge "<tail> <head>" per line and 0-based
+// vertex IDs, or files written by EdgeListWriter, with lines "e <tail> <head>" and 1-based vertex IDs, preceded by an
+// optional header "p <n> <m>". Lines starting with #, % or c are ignored, as is any text following the head of an edge.
+class EdgeListReader {
+public:
+    EdgeListReader(const std::string& filename);
+
+    // Parses the edges whose lines start in the `rank`-th of `size` equally sized byte ranges of the body of the file.
+    // The range is split among the OpenMP threads of the PE.
+    EdgeListFragment ReadByteRange(PEID rank, PEID size);
+
+private:
+    std::string     filename_;
+    MappedFileToker toker_;
+};
+
+// Reads edge lists written by BinaryEdgeListWriter: pairs of 32 or 64 bit vertex IDs, optionally preceded by a header
+// with the number of vertices and edges, which is detected by comparing the number of edges to the size of the file.
+class BinaryEdgeListReader {
+public:
+    BinaryEdgeListReader(const std::string& filename, int width);
+
+    // Reads the `rank`-th of `size` equally sized ranges of edges.
+    EdgeListFragment ReadByteRange(PEID rank, PEID size);
+
+private:
+    int        width_;
+    MappedFile file_;
+
+    SInt header_size_  = 0;
+    SInt num_vertices_ = 0;
+    SInt num_edges_    = 0;
+};
+} // namespace kagen::staticgraph
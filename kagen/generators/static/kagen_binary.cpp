@@ -0,0 +1,123 @@
+#include "kagen/generators/static/kagen_binary.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "kagen/definitions.h"
+
+namespace kagen::staticgraph {
+namespace {
+bool IsValidWidth(const std::uint8_t width, const bool optional) {
+    return width == 4 || width == 8 || (optional && width == 0);
+}
+} // namespace
+
+KaGenBinaryReader::KaGenBinaryReader(const std::string& filename) : file_(filename) {
+    const std::size_t length = file_.Length();
+    if (length < sizeof(KaGenBinaryHeader)) {
+        throw IOError("input file is too small for a KaGen binary graph");
+    }
+    std::memcpy(&header_, file_.Data(), sizeof(KaGenBinaryHeader));
+
+    const SInt n    = header_.num_vertices;
+    const SInt m    = header_.num_edges;
+    const bool fits = header_.xadj_pos + (n + 1) * header_.offset_width <= length
+                      && header_.adjncy_pos + m * header_.id_width <= length
+                      && header_.vertex_weights_pos + n * header_.vertex_weight_width <= length
+                      && header_.edge_weights_pos + m * header_.edge_weight_width <= length;
+    if (std::memcmp(header_.magic, kKaGenBinaryMagic, sizeof(header_.magic)) != 0
+        || header_.version != kKaGenBinaryVersion || !IsValidWidth(header_.id_width, false)
+        || !IsValidWidth(header_.offset_width, false) || !IsValidWidth(header_.vertex_weight_width, true)
+        || !IsValidWidth(header_.edge_weight_width, true) || !fits) {
+        throw IOError("invalid or unsupported KaGen binary graph format");
+    }
+}
+
+GraphSize KaGenBinaryReader::ReadSize() {
+    return {header_.num_vertices, header_.num_edges};
+}
+
+Graph KaGenBinaryReader::Read(
+    const SInt from, SInt to_node, const SInt to_edge, const GraphRepresentation representation) {
+    if (to_node > header_.num_vertices) {
+        to_node = FindNodeByEdge(to_edge);
+    }
+
+    const SInt num_local_nodes = to_node - from;
+    const SInt first_edge      = ReadOffset(from);
+    const SInt num_local_edges = ReadOffset(to_node) - first_edge;
+
+    // Offsets relative to the first local edge
+    XadjArray xadj(num_local_nodes + 1);
+    ConvertArray(file_.Data() + header_.xadj_pos, header_.offset_width, from, num_local_nodes + 1, xadj.data());
+#pragma omp parallel for
+    for (SInt u = 0; u <= num_local_nodes; ++u) {
+        xadj[u] -= first_edge;
+    }
+
+    Graph ans;
+    ans.vertex_range   = {from, to_node};
+    ans.representation = representation;
+
+    const char* adjncy = file_.Data() + header_.adjncy_pos;
+    if (representation == GraphRepresentation::EDGE_LIST) {
+        ans.edges.resize(num_local_edges);
+
+        auto build_edge_list = [&](const auto* heads) {
+#pragma omp parallel for schedule(dynamic, 1024)
+            for (SInt u = 0; u < num_local_nodes; ++u) {
+                for (SInt e = xadj[u]; e < xadj[u + 1]; ++e) {
+                    ans.edges[e] = {from + u, static_cast<VertexID>(heads[first_edge + e])};
+                }
+            }
+        };
+        if (header_.id_width == 4) {
+            build_edge_list(reinterpret_cast<const std::uint32_t*>(adjncy));
+        } else {
+            build_edge_list(reinterpret_cast<const std::uint64_t*>(adjncy));
+        }
+    } else {
+        ans.adjncy.resize(num_local_edges);
+        ConvertArray(adjncy, header_.id_width, first_edge, num_local_edges, ans.adjncy.data());
+        ans.xadj = std::move(xadj);
+    }
+
+    if (header_.vertex_weight_width > 0) {
+        ans.vertex_weights.resize(num_local_nodes);
+        ConvertArray(
+            file_.Data() + header_.vertex_weights_pos, header_.vertex_weight_width, from, num_local_nodes,
+            ans.vertex_weights.data());
+    }
+    if (header_.edge_weight_width > 0) {
+        ans.edge_weights.resize(num_local_edges);
+        ConvertArray(
+            file_.Data() + header_.edge_weights_pos, header_.edge_weight_width, first_edge, num_local_edges,
+            ans.edge_weights.data());
+    }
+
+    return ans;
+}
+
+SInt KaGenBinaryReader::FindNodeByEdge(const SInt edge) {
+    // First vertex whose first edge is not before `edge`
+    SInt low  = 0;
+    SInt high = header_.num_vertices;
+    while (low < high) {
+        const SInt mid = low + (high - low) / 2;
+        if (ReadOffset(mid) < edge) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+SInt KaGenBinaryReader::ReadOffset(const SInt u) const {
+    if (header_.offset_width == 4) {
+        return reinterpret_cast<const std::uint32_t*>(file_.Data() + header_.xadj_pos)[u];
+    } else {
+        return reinterpret_cast<const std::uint64_t*>(file_.Data() + header_.xadj_pos)[u];
+    }
+}
+} // namespace kagen::staticgraph
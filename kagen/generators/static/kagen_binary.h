@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "kagen/generators/static/graph_reader.h"
+#include "kagen/generators/static/mapped_file.h"
+#include "kagen/io/kagen_binary.h"
+
+namespace kagen::staticgraph {
+// Reads graphs in KaGen's native binary CSR format from a memory mapping of the file, see kagen/io/kagen_binary.h
+class KaGenBinaryReader : public GraphReader {
+public:
+    KaGenBinaryReader(const std::string& filename);
+
+    GraphSize ReadSize() final;
+
+    Graph Read(SInt from, SInt to_node, SInt to_edge, GraphRepresentation representation) final;
+
+    SInt FindNodeByEdge(SInt edge) final;
+
+private:
+    SInt ReadOffset(SInt u) const;
+
+    MappedFile        file_;
+    KaGenBinaryHeader header_{};
+};
+} // namespace kagen::staticgraph
@@ -0,0 +1,166 @@
+#include "kagen/generators/static/manifest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/tools/radix_sort.h"
+
+namespace kagen::staticgraph {
+namespace {
+constexpr std::string_view kManifestSuffix = ".manifest";
+
+// Size of the optional file header of binary edge lists, see BinaryEdgeListWriter::WriteHeader()
+constexpr SInt kBinaryEdgeListHeaderSize = 2 * sizeof(SInt);
+
+// Products of 64 bit edge and vertex counts might overflow
+__extension__ typedef unsigned __int128 uint128_t;
+
+template <typename UInt>
+void AppendLocalEdges(const char* data, const SInt num_edges, const SInt from, const SInt to_node, EdgeList& edges) {
+    for (SInt e = 0; e < num_edges; ++e) {
+        UInt edge[2];
+        std::memcpy(edge, data + 2 * e * sizeof(UInt), sizeof(edge));
+        if (edge[0] >= from && edge[0] < to_node) {
+            edges.emplace_back(edge[0], edge[1]);
+        }
+    }
+}
+} // namespace
+
+ManifestReader::ManifestReader(const std::string& filename) {
+    if (filename.size() <= kManifestSuffix.size()
+        || filename.compare(filename.size() - kManifestSuffix.size(), kManifestSuffix.size(), kManifestSuffix) != 0) {
+        throw IOError("manifest filename must end with .manifest");
+    }
+    base_filename_ = filename.substr(0, filename.size() - kManifestSuffix.size());
+
+    std::ifstream in(filename, std::ios_base::binary);
+    if (!in) {
+        throw IOError("cannot open input file");
+    }
+    in.read(reinterpret_cast<char*>(&header_), sizeof(KaGenManifestHeader));
+    if (!in || std::memcmp(header_.magic, kKaGenManifestMagic, sizeof(header_.magic)) != 0
+        || header_.version != kKaGenManifestVersion) {
+        throw IOError("invalid or unsupported manifest format");
+    }
+
+    entries_.resize(header_.num_files);
+    in.read(reinterpret_cast<char*>(entries_.data()), entries_.size() * sizeof(KaGenManifestEntry));
+    if (!in) {
+        throw IOError("manifest is truncated");
+    }
+
+    const auto format = static_cast<OutputFormat>(header_.output_format);
+    if (format == OutputFormat::BINARY_EDGE_LIST) {
+        id_width_ = sizeof(std::uint64_t);
+    } else if (format == OutputFormat::BINARY_EDGE_LIST32) {
+        id_width_ = sizeof(std::uint32_t);
+    } else {
+        throw IOError("manifest describes files that cannot be loaded: only binary edge lists are supported");
+    }
+    if (static_cast<OutputCompression>(header_.output_compression) != OutputCompression::NONE) {
+        throw IOError("manifest describes compressed files, which cannot be loaded");
+    }
+}
+
+GraphSize ManifestReader::ReadSize() {
+    return {header_.num_vertices, header_.num_edges};
+}
+
+Graph ManifestReader::Read(
+    const SInt from, SInt to_node, const SInt to_edge, const GraphRepresentation representation) {
+    if (to_node > header_.num_vertices) {
+        to_node = FindNodeByEdge(to_edge);
+    }
+
+    EdgeList edges;
+    for (SInt file = 0; file < entries_.size(); ++file) {
+        const auto& entry = entries_[file];
+        if (entry.first_tail < to_node && from < entry.last_tail) {
+            ReadEdges(file, from, to_node, edges);
+        }
+    }
+    RadixSortEdges(edges);
+
+    Graph ans;
+    ans.vertex_range   = {from, to_node};
+    ans.representation = representation;
+
+    if (representation == GraphRepresentation::EDGE_LIST) {
+        ans.edges = std::move(edges);
+    } else {
+        const SInt num_local_nodes = to_node - from;
+        ans.xadj.resize(num_local_nodes + 1);
+        ans.adjncy.reserve(edges.size());
+
+        SInt cur_edge = 0;
+        for (SInt u = 0; u < num_local_nodes; ++u) {
+            ans.xadj[u] = cur_edge;
+            while (cur_edge < edges.size() && std::get<0>(edges[cur_edge]) == from + u) {
+                ans.adjncy.push_back(std::get<1>(edges[cur_edge]));
+                ++cur_edge;
+            }
+        }
+        ans.xadj.back() = cur_edge;
+    }
+
+    return ans;
+}
+
+SInt ManifestReader::FindNodeByEdge(const SInt edge) {
+    if (edge == 0) { // Files written by the first PEs might not contain any edges
+        return 0;
+    }
+
+    SInt first_edge = 0;
+    for (const auto& entry: entries_) {
+        if (edge < first_edge + entry.num_edges) {
+            const SInt num_vertices = entry.last_vertex - entry.first_vertex;
+            const auto offset = static_cast<uint128_t>(edge - first_edge) * num_vertices / entry.num_edges;
+            return entry.first_vertex + static_cast<SInt>(offset);
+        }
+        first_edge += entry.num_edges;
+    }
+    return header_.num_vertices;
+}
+
+void ManifestReader::ReadEdges(const SInt file, const SInt from, const SInt to_node, EdgeList& edges) const {
+    const auto&       entry    = entries_[file];
+    const std::string filename = base_filename_ + "." + std::to_string(file);
+
+    std::ifstream in(filename, std::ios_base::binary);
+    if (!in) {
+        throw IOError("cannot open " + filename);
+    }
+
+    std::vector<char> contents(entry.num_bytes);
+    in.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        throw IOError(filename + " does not have the size recorded in the manifest");
+    }
+    if (ComputeChecksum(contents.data(), contents.size()) != entry.checksum) {
+        throw IOError(filename + " does not match the checksum recorded in the manifest");
+    }
+
+    // The file header is optional, depending on --output-header
+    const SInt num_edge_bytes = 2 * entry.num_edges * id_width_;
+    const SInt header_size    = entry.num_bytes - num_edge_bytes;
+    if (entry.num_bytes < num_edge_bytes || (header_size != 0 && header_size != kBinaryEdgeListHeaderSize)) {
+        throw IOError(filename + " does not contain the number of edges recorded in the manifest");
+    }
+
+    const char* data = contents.data() + header_size;
+    if (id_width_ == sizeof(std::uint64_t)) {
+        AppendLocalEdges<std::uint64_t>(data, entry.num_edges, from, to_node, edges);
+    } else {
+        AppendLocalEdges<std::uint32_t>(data, entry.num_edges, from, to_node, edges);
+    }
+}
+} // namespace kagen::staticgraph
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "kagen/generators/static/graph_reader.h"
+#include "kagen/io/manifest.h"
+
+namespace kagen::staticgraph {
+// Reads a graph that was written with distributed output from the files listed in its manifest, see
+// kagen/io/manifest.h. Each PE only reads the files that contain edges whose tails lie in its vertex range, thus the
+// number of PEs may differ from the number of files. Only uncompressed binary edge lists are supported.
+class ManifestReader : public GraphReader {
+public:
+    ManifestReader(const std::string& filename);
+
+    GraphSize ReadSize() final;
+
+    Graph Read(SInt from, SInt to_node, SInt to_edge, GraphRepresentation representation) final;
+
+    // Approximate: assumes that the edges of each file are evenly distributed across the vertex range of the PE that
+    // wrote it.
+    SInt FindNodeByEdge(SInt edge) final;
+
+private:
+    void ReadEdges(SInt file, SInt from, SInt to_node, EdgeList& edges) const;
+
+    std::string                     base_filename_;
+    KaGenManifestHeader             header_{};
+    std::vector<KaGenManifestEntry> entries_;
+    SInt                            id_width_ = 0;
+};
+} // namespace kagen::staticgraph
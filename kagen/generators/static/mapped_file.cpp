@@ -0,0 +1,36 @@
+#include "kagen/generators/static/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace kagen::staticgraph {
+MappedFile::MappedFile(const std::string& filename) {
+    fd_ = open(filename.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        throw IOError("cannot open input file");
+    }
+
+    struct stat file_info {};
+    fstat(fd_, &file_info);
+    length_ = static_cast<std::size_t>(file_info.st_size);
+    if (length_ == 0) {
+        return;
+    }
+
+    void* contents = mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (contents == MAP_FAILED) {
+        close(fd_);
+        throw IOError("mmap failed");
+    }
+    contents_ = static_cast<const char*>(contents);
+}
+
+MappedFile::~MappedFile() {
+    if (contents_ != nullptr) {
+        munmap(const_cast<char*>(contents_), length_);
+    }
+    close(fd_);
+}
+} // namespace kagen::staticgraph
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "kagen/generators/static/graph_reader.h"
+
+namespace kagen::staticgraph {
+// Read-only memory mapping of a whole file, used by the readers of binary formats; throws IOError if the file cannot be
+// opened or mapped. Empty files are not mapped, i.e., Data() is nullptr.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filename);
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    [[nodiscard]] const char* Data() const {
+        return contents_;
+    }
+
+    [[nodiscard]] std::size_t Length() const {
+        return length_;
+    }
+
+private:
+    int         fd_       = -1;
+    std::size_t length_   = 0;
+    const char* contents_ = nullptr;
+};
+
+// Copies `count` elements from the mapped file to `out`; a plain copy if the types have the same representation
+template <typename T, typename Out>
+void ConvertArray(const T* data, const SInt count, Out* out) {
+    if constexpr (sizeof(T) == sizeof(Out) && std::is_signed_v<T> == std::is_signed_v<Out>) {
+        std::memcpy(out, data, count * sizeof(T));
+    } else {
+#pragma omp parallel for
+        for (SInt i = 0; i < count; ++i) {
+            out[i] = static_cast<Out>(data[i]);
+        }
+    }
+}
+
+// Copies elements [first, first + count) of an array of 4 or 8 byte integers to `out`; the elements are signed iff
+// `Out` is signed
+template <typename Out>
+void ConvertArray(const char* array, const std::size_t width, const SInt first, const SInt count, Out* out) {
+    using Int32 = std::conditional_t<std::is_signed_v<Out>, std::int32_t, std::uint32_t>;
+    using Int64 = std::conditional_t<std::is_signed_v<Out>, std::int64_t, std::uint64_t>;
+
+    if (width == 4) {
+        ConvertArray(reinterpret_cast<const Int32*>(array) + first, count, out);
+    } else {
+        ConvertArray(reinterpret_cast<const Int64*>(array) + first, count, out);
+    }
+}
+} // namespace kagen::staticgraph
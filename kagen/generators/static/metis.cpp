@@ -1,4 +1,21 @@
 #include "kagen/generators/static/metis.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 #include "kagen/generators/static/mmap_toker.h"
 
 namespace kagen::staticgraph {
@@ -39,11 +56,13 @@ template <typename NodeCB, typename EdgeCB>
 void ParseBody(
     MappedFileToker& toker, NodeCB&& node_cb, EdgeCB&& edge_cb, const SInt num_nodes, const bool has_node_weights,
     const bool has_edge_weights) {
-    static_assert(std::is_invocable_v<NodeCB, std::uint64_t>);
+    static_assert(std::is_invocable_v<NodeCB, std::uint64_t, std::size_t>);
     static_assert(std::is_invocable_v<EdgeCB, std::uint64_t, std::uint64_t>);
 
     bool exited_preemptively = false;
     for (std::uint64_t u = 0; u < num_nodes; ++u) {
+        const std::size_t line_start = toker.Position();
+
         toker.SkipSpaces();
         while (toker.TestChar('%')) {
             toker.SkipLine();
@@ -54,7 +73,7 @@ void ParseBody(
         if (has_node_weights) {
             node_weight = toker.ScanUnsigned();
         }
-        if (!node_cb(node_weight)) {
+        if (!node_cb(node_weight, line_start)) {
             exited_preemptively = true;
             break;
         }
@@ -84,19 +103,57 @@ void ParseBody(
     }
 }
 
-template <typename FormatCB, typename NodeCB, typename EdgeCB>
-void Parse(MappedFileToker& toker, FormatCB&& format_cb, NodeCB&& node_cb, EdgeCB&& edge_cb) {
-    static_assert(std::is_invocable_v<FormatCB, Format>);
+std::int64_t GetModificationTime(const std::string& filename) {
+    struct stat file_info {};
+    stat(filename.c_str(), &file_info);
+    return static_cast<std::int64_t>(file_info.st_mtime);
+}
+
+std::string GetIndexFilename(const std::string& filename) {
+    return filename + ".idx";
+}
+
+// Parses the lines that start in [begin, end) of the body of a METIS file, which starts at `body_start`
+MetisFragment ParseFragment(
+    MappedFileToker& toker, const SInt body_start, const SInt begin, const SInt end, const bool has_node_weights,
+    const bool has_edge_weights) {
+    // The line that contains `begin` belongs to the previous range, unless it starts at `begin`
+    toker.Seek(begin);
+    if (begin > body_start && begin < end && toker.Previous() != '\n') {
+        toker.SkipLine();
+    }
+
+    MetisFragment fragment;
+    while (toker.ValidPosition() && toker.Position() < end) {
+        toker.SkipSpaces();
+        if (toker.TestChar('%')) {
+            toker.SkipLine();
+            continue;
+        }
+
+        fragment.xadj.push_back(fragment.adjncy.size());
+        if (has_node_weights) {
+            fragment.vertex_weights.push_back(static_cast<SSInt>(toker.ScanUnsigned()));
+        }
+
+        while (toker.ValidPosition() && std::isdigit(toker.Current())) {
+            fragment.adjncy.push_back(toker.ScanUnsigned() - 1);
+            if (has_edge_weights) {
+                fragment.edge_weights.push_back(static_cast<SSInt>(toker.ScanUnsigned()));
+            }
+        }
+
+        if (toker.ValidPosition() && !toker.ConsumeChar('\n')) {
+            throw IOError("unexpected char in neighbors list");
+        }
+    }
+    fragment.xadj.push_back(fragment.adjncy.size());
 
-    const Format format = ParseHeader(toker);
-    format_cb(format);
-    ParseBody<NodeCB, EdgeCB>(
-        toker, std::forward<NodeCB>(node_cb), std::forward<EdgeCB>(edge_cb), format.number_of_nodes,
-        format.has_node_weights, format.has_edge_weights);
+    return fragment;
 }
 } // namespace
 
-MetisReader::MetisReader(const std::string& filename) : toker_(filename) {}
+MetisReader::MetisReader(const std::string& filename) : filename_(filename), toker_(filename) {}
 
 GraphSize MetisReader::ReadSize() {
     toker_.Reset();
@@ -106,23 +163,19 @@ GraphSize MetisReader::ReadSize() {
 
 Graph MetisReader::Read(
     const SInt from, const SInt to_node, const SInt to_edge, const GraphRepresentation representation) {
-    SInt current_node = 0;
-    SInt current_edge = 0;
-
     toker_.Reset();
     const auto [global_n, global_m, has_node_weights, has_edge_weights] = ParseHeader(toker_);
 
-    if (cached_first_node_pos_ > 0 && cached_first_node_ == from) {
-        current_node = cached_first_node_;
-        current_edge = cached_first_edge_;
-        toker_.Seek(cached_first_node_pos_);
-    }
+    SInt current_node, current_edge;
+    std::tie(current_node, current_edge) = SeekToNode(from);
 
     Graph graph;
     if (representation == GraphRepresentation::EDGE_LIST) {
         ParseBody(
             toker_,
-            [&, has_node_weights = has_node_weights](const SInt weight) {
+            [&, has_node_weights = has_node_weights](const SInt weight, const std::size_t position) {
+                ExtendIndex(current_node, current_edge, position);
+
                 if (has_node_weights && current_node >= from) {
                     graph.vertex_weights.push_back(weight);
                 }
@@ -141,11 +194,13 @@ Graph MetisReader::Read(
                     graph.edges.emplace_back(current_node - 1, to);
                 }
             },
-            global_n, has_node_weights, has_edge_weights);
+            global_n - current_node, has_node_weights, has_edge_weights);
     } else if (representation == GraphRepresentation::CSR) {
         ParseBody(
             toker_,
-            [&, has_node_weights = has_node_weights](const SInt weight) {
+            [&, has_node_weights = has_node_weights](const SInt weight, const std::size_t position) {
+                ExtendIndex(current_node, current_edge, position);
+
                 if (current_node >= from) {
                     graph.xadj.push_back(graph.adjncy.size());
                     if (has_node_weights) {
@@ -167,37 +222,214 @@ Graph MetisReader::Read(
                     graph.adjncy.push_back(to);
                 }
             },
-            global_n, has_node_weights, has_edge_weights);
+            global_n - current_node, has_node_weights, has_edge_weights);
         graph.xadj.push_back(graph.adjncy.size());
     } else {
         __builtin_unreachable();
     }
 
+    PersistIndex(global_n);
+
     graph.vertex_range   = {from, current_node};
     graph.representation = representation;
     return graph;
 }
 
 SInt MetisReader::FindNodeByEdge(const SInt edge) {
-    SInt current_node = 0;
-    SInt current_edge = 0;
-
     toker_.Reset();
-    Parse(
-        toker_, [](auto) {},
-        [&](SInt) {
+    const auto [global_n, global_m, has_node_weights, has_edge_weights] = ParseHeader(toker_);
+
+    SInt current_node, current_edge;
+    std::tie(current_node, current_edge) = SeekToEdge(edge);
+    ParseBody(
+        toker_,
+        [&](SInt, const std::size_t position) {
+            ExtendIndex(current_node, current_edge, position);
+
             if (current_edge < edge) {
                 ++current_node;
                 return true;
             }
             return false;
         },
-        [&](SInt, SInt) { ++current_edge; });
+        [&](SInt, SInt) { ++current_edge; }, global_n - current_node, has_node_weights, has_edge_weights);
 
-    cached_first_node_     = current_node;
-    cached_first_edge_     = current_edge;
-    cached_first_node_pos_ = toker_.Position();
+    PersistIndex(global_n);
 
     return current_node;
 }
+
+MetisFragment MetisReader::ReadByteRange(const PEID rank, const PEID size) {
+    toker_.Reset();
+    const auto [global_n, global_m, has_node_weights, has_edge_weights] = ParseHeader(toker_);
+
+    const SInt body_start  = toker_.Position();
+    const SInt body_length = toker_.Length() - body_start;
+    const SInt begin       = body_start + body_length * rank / size;
+    const SInt end         = body_start + body_length * (rank + 1) / size;
+
+    toker_.Prefetch(begin, end);
+
+#ifdef _OPENMP
+    const int num_threads = static_cast<int>(std::min<SInt>(omp_get_max_threads(), end - begin));
+#else
+    const int num_threads = 1;
+#endif
+    if (num_threads <= 1) {
+        return ParseFragment(toker_, body_start, begin, end, has_node_weights, has_edge_weights);
+    }
+
+    // Each thread parses the lines that start in its part of the byte range with its own mapping of the file; the
+    // fragments are concatenated in thread order, thus the result does not depend on the number of threads
+    std::vector<MetisFragment>      fragments(num_threads);
+    std::vector<std::exception_ptr> errors(num_threads);
+#pragma omp parallel num_threads(num_threads)
+    {
+#ifdef _OPENMP
+        const int thread = omp_get_thread_num();
+#else
+        const int thread = 0;
+#endif
+        const SInt thread_begin = begin + (end - begin) * thread / num_threads;
+        const SInt thread_end   = begin + (end - begin) * (thread + 1) / num_threads;
+        try {
+            MappedFileToker toker(filename_);
+            fragments[thread] =
+                ParseFragment(toker, body_start, thread_begin, thread_end, has_node_weights, has_edge_weights);
+        } catch (...) {
+            errors[thread] = std::current_exception();
+        }
+    }
+    for (const auto& error: errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::vector<SInt> first_node(num_threads + 1);
+    std::vector<SInt> first_edge(num_threads + 1);
+    for (int thread = 0; thread < num_threads; ++thread) {
+        first_node[thread + 1] = first_node[thread] + fragments[thread].xadj.size() - 1;
+        first_edge[thread + 1] = first_edge[thread] + fragments[thread].adjncy.size();
+    }
+
+    MetisFragment fragment;
+    fragment.xadj.resize(first_node.back() + 1);
+    fragment.adjncy.resize(first_edge.back());
+    fragment.vertex_weights.resize(has_node_weights ? first_node.back() : 0);
+    fragment.edge_weights.resize(has_edge_weights ? first_edge.back() : 0);
+#pragma omp parallel for num_threads(num_threads)
+    for (int thread = 0; thread < num_threads; ++thread) {
+        auto& local = fragments[thread];
+        for (SInt u = 0; u + 1 < local.xadj.size(); ++u) {
+            fragment.xadj[first_node[thread] + u] = first_edge[thread] + local.xadj[u];
+        }
+        std::copy(local.adjncy.begin(), local.adjncy.end(), fragment.adjncy.begin() + first_edge[thread]);
+        std::copy(
+            local.vertex_weights.begin(), local.vertex_weights.end(),
+            fragment.vertex_weights.begin() + first_node[thread]);
+        std::copy(
+            local.edge_weights.begin(), local.edge_weights.end(), fragment.edge_weights.begin() + first_edge[thread]);
+        local = {};
+    }
+    fragment.xadj.back() = first_edge.back();
+
+    return fragment;
+}
+
+std::pair<SInt, SInt> MetisReader::SeekToNode(const SInt node) {
+    EnsureIndexLoaded();
+    if (index_.empty()) {
+        return {0, 0};
+    }
+
+    const SInt entry = std::min<SInt>(node >> kMetisIndexLogStride, index_.size() - 1);
+    toker_.Seek(index_[entry].position);
+    return {entry << kMetisIndexLogStride, index_[entry].first_edge};
+}
+
+std::pair<SInt, SInt> MetisReader::SeekToEdge(const SInt edge) {
+    EnsureIndexLoaded();
+    if (index_.empty()) {
+        return {0, 0};
+    }
+
+    // Last indexed vertex with an edge before `edge`, or the first vertex
+    const auto it = std::partition_point(
+        index_.begin(), index_.end(), [&](const MetisIndexEntry& entry) { return entry.first_edge < edge; });
+    const SInt entry = std::max<SInt>(std::distance(index_.begin(), it), 1) - 1;
+    toker_.Seek(index_[entry].position);
+    return {entry << kMetisIndexLogStride, index_[entry].first_edge};
+}
+
+void MetisReader::ExtendIndex(const SInt node, const SInt first_edge, const std::size_t position) {
+    if ((node & ((SInt{1} << kMetisIndexLogStride) - 1)) == 0 && (node >> kMetisIndexLogStride) == index_.size()) {
+        index_.push_back({position, first_edge});
+    }
+}
+
+void MetisReader::PersistIndex(const SInt num_nodes) {
+    const SInt num_entries = (num_nodes + (SInt{1} << kMetisIndexLogStride) - 1) >> kMetisIndexLogStride;
+    if (index_persisted_ || index_.size() != num_entries || num_entries == 0) {
+        return;
+    }
+    index_persisted_ = true;
+
+    MetisIndexHeader header{};
+    std::memcpy(header.magic, kMetisIndexMagic, sizeof(header.magic));
+    header.version     = kMetisIndexVersion;
+    header.log_stride  = kMetisIndexLogStride;
+    header.file_size   = toker_.Length();
+    header.file_mtime  = GetModificationTime(filename_);
+    header.num_entries = index_.size();
+
+    // Several PEs might complete the index at the same time: write to a temporary file and rename it atomically
+    const std::string index_filename = GetIndexFilename(filename_);
+    std::string       tmp_filename   = index_filename + ".XXXXXX";
+    const int         fd             = mkstemp(tmp_filename.data());
+    if (fd < 0) {
+        return;
+    }
+    fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH); // mkstemp() creates files that only the owner may read
+
+    const std::size_t entries_size = index_.size() * sizeof(MetisIndexEntry);
+    const bool        success      = write(fd, &header, sizeof(MetisIndexHeader)) == sizeof(MetisIndexHeader)
+                             && write(fd, index_.data(), entries_size) == static_cast<ssize_t>(entries_size);
+    close(fd);
+
+    if (!success || std::rename(tmp_filename.c_str(), index_filename.c_str()) != 0) {
+        std::remove(tmp_filename.c_str());
+    }
+}
+
+void MetisReader::EnsureIndexLoaded() {
+    if (!index_loaded_) {
+        index_loaded_    = true;
+        index_persisted_ = LoadIndex();
+    }
+}
+
+bool MetisReader::LoadIndex() {
+    std::ifstream in(GetIndexFilename(filename_), std::ios_base::binary);
+    if (!in) {
+        return false;
+    }
+
+    MetisIndexHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(MetisIndexHeader));
+    if (!in || std::memcmp(header.magic, kMetisIndexMagic, sizeof(header.magic)) != 0
+        || header.version != kMetisIndexVersion || header.log_stride != kMetisIndexLogStride
+        || header.file_size != toker_.Length() || header.file_mtime != GetModificationTime(filename_)) {
+        return false;
+    }
+
+    index_.resize(header.num_entries);
+    in.read(reinterpret_cast<char*>(index_.data()), index_.size() * sizeof(MetisIndexEntry));
+    if (!in) {
+        index_.clear();
+        return false;
+    }
+
+    return true;
+}
 } // namespace kagen::staticgraph
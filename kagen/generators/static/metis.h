@@ -1,9 +1,43 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "kagen/generators/static/graph_reader.h"
 #include "kagen/generators/static/mmap_toker.h"
 
 namespace kagen::staticgraph {
+// Sidecar index of a METIS file, stored as <filename>.idx: for every 2^log_stride-th vertex, the byte position of its
+// line and the number of edges (adjacency entries) before it. Valid as long as the size and modification time of the
+// METIS file match the ones recorded in the header.
+constexpr char          kMetisIndexMagic[8]  = {'K', 'A', 'G', 'E', 'N', 'I', 'D', 'X'};
+constexpr std::uint32_t kMetisIndexVersion   = 1;
+constexpr std::uint32_t kMetisIndexLogStride = 12;
+
+struct MetisIndexHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t log_stride;
+    std::uint64_t file_size;
+    std::int64_t  file_mtime;
+    std::uint64_t num_entries;
+};
+
+struct MetisIndexEntry {
+    std::uint64_t position;
+    std::uint64_t first_edge;
+};
+
+// Vertices of a METIS file parsed by ReadByteRange(), numbered from zero. Weights are only set if the file has them.
+struct MetisFragment {
+    XadjArray     xadj;
+    AdjncyArray   adjncy;
+    VertexWeights vertex_weights;
+    EdgeWeights   edge_weights;
+};
+
 class MetisReader : public GraphReader {
 public:
     MetisReader(const std::string& filename);
@@ -14,11 +48,33 @@ public:
 
     SInt FindNodeByEdge(SInt edge) final;
 
+    // Parses the vertices whose lines start in the `rank`-th of `size` equally sized byte ranges of the body of the
+    // file, without reading any other part of the body. Their global IDs are only known after counting the vertices
+    // parsed by all PEs with smaller ranks.
+    MetisFragment ReadByteRange(PEID rank, PEID size);
+
 private:
+    // Moves the toker to the closest indexed vertex that is not after `node` resp. whose first edge is before `edge`,
+    // and returns that vertex and its first edge. Must be called right after parsing the header.
+    std::pair<SInt, SInt> SeekToNode(SInt node);
+    std::pair<SInt, SInt> SeekToEdge(SInt edge);
+
+    // Called with the start of the line of each vertex while parsing; extends the index by the next indexed vertex
+    void ExtendIndex(SInt node, SInt first_edge, std::size_t position);
+
+    // Writes the index to the sidecar file once it covers all `num_nodes` vertices; failures are silently ignored
+    void PersistIndex(SInt num_nodes);
+
+    // The index is only used to seek, thus ReadByteRange() never reads the sidecar file
+    void EnsureIndexLoaded();
+
+    bool LoadIndex();
+
+    std::string     filename_;
     MappedFileToker toker_;
 
-    SInt cached_first_node_     = 0;
-    SInt cached_first_edge_     = 0;
-    SInt cached_first_node_pos_ = 0;
+    std::vector<MetisIndexEntry> index_;
+    bool                         index_loaded_    = false;
+    bool                         index_persisted_ = false;
 };
 } // namespace kagen::staticgraph
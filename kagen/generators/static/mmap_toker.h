@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 
@@ -9,6 +12,10 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 namespace kagen {
 class MappedFileToker {
 public:
@@ -21,6 +28,7 @@ public:
             close(fd_);
             throw std::runtime_error{"mmap failed"};
         }
+        madvise(contents_, length_, MADV_SEQUENTIAL);
     }
 
     ~MappedFileToker() {
@@ -37,35 +45,61 @@ public:
     }
 
     void SkipSpaces() {
-        while (ValidPosition() && Current() == ' ') {
+        while (ValidPosition() && (Current() == ' ' || Current() == '\t')) {
             Advance();
         }
     }
 
-    void SkipLine() {
-        while (ValidPosition() && Current() != '\n') {
-            Advance();
-        }
-        if (ValidPosition()) {
-            Advance();
+    // Asks the kernel to read [begin, end) of the file ahead of time
+    void Prefetch(const std::size_t begin, const std::size_t end) {
+        const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t first     = begin / page_size * page_size;
+        if (first < std::min(end, length_)) {
+            madvise(contents_ + first, std::min(end, length_) - first, MADV_WILLNEED);
         }
     }
 
+    void SkipLine() {
+        const void* newline = ValidPosition() ? std::memchr(contents_ + position_, '\n', length_ - position_) : nullptr;
+        position_           = (newline != nullptr) ? static_cast<const char*>(newline) - contents_ + 1 : length_;
+    }
+
     inline std::uint64_t ScanUnsigned() {
+        // Fast path: the number ends within the next word
+        if (position_ + kWordSize <= length_) {
+            const std::uint64_t word       = LoadWord(position_);
+            const std::size_t   num_digits = CountDigits(word);
+            if (num_digits < kWordSize) {
+                position_ += num_digits;
+                SkipSpaces();
+                return (num_digits > 0) ? ParseWord(word, num_digits) : 0;
+            }
+        }
+
+        const std::size_t num_digits = CountDigits();
+
         std::uint64_t number = 0;
-        while (ValidPosition() && std::isdigit(Current())) {
-            const int digit = Current() - '0';
-            number          = number * 10 + digit;
-            Advance();
+        std::size_t   i      = 0;
+        if (position_ + num_digits + kWordSize <= length_) {
+            for (; i + kWordSize <= num_digits; i += kWordSize) {
+                number = number * 100000000 + ParseWord(LoadWord(position_ + i), kWordSize);
+            }
+            if (i < num_digits) {
+                number = number * kPowersOfTen[num_digits - i] + ParseWord(LoadWord(position_ + i), num_digits - i);
+            }
+        } else { // Close to the end of the file, words cannot be loaded
+            for (; i < num_digits; ++i) {
+                number = number * 10 + (contents_[position_ + i] - '0');
+            }
         }
+
+        position_ += num_digits;
         SkipSpaces();
         return number;
     }
 
     void SkipInt() {
-        while (ValidPosition() && std::isdigit(Current())) {
-            Advance();
-        }
+        position_ += CountDigits();
         SkipSpaces();
     }
 
@@ -107,6 +141,10 @@ public:
         return contents_[position_];
     }
 
+    [[nodiscard]] char Previous() const {
+        return contents_[position_ - 1];
+    }
+
     void Advance() {
         ++position_;
     }
@@ -120,6 +158,65 @@ public:
     }
 
 private:
+    static constexpr std::size_t kWordSize = sizeof(std::uint64_t);
+
+    static constexpr std::uint64_t kPowersOfTen[kWordSize + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+                                                                   100000000};
+
+    // Number of consecutive digits starting at the current position; scans 16 bytes at a time if possible
+    [[nodiscard]] std::size_t CountDigits() const {
+        std::size_t pos = position_;
+#if defined(__SSE2__)
+        const __m128i below_zero = _mm_set1_epi8('0' - 1);
+        const __m128i above_nine = _mm_set1_epi8('9' + 1);
+        while (pos + sizeof(__m128i) <= length_) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(contents_ + pos));
+            const __m128i is_digit =
+                _mm_and_si128(_mm_cmpgt_epi8(chunk, below_zero), _mm_cmplt_epi8(chunk, above_nine));
+            const unsigned non_digits = ~static_cast<unsigned>(_mm_movemask_epi8(is_digit)) & 0xFFFF;
+            if (non_digits != 0) {
+                return pos + __builtin_ctz(non_digits) - position_;
+            }
+            pos += sizeof(__m128i);
+        }
+#endif
+        while (pos < length_ && static_cast<unsigned char>(contents_[pos] - '0') < 10) {
+            ++pos;
+        }
+        return pos - position_;
+    }
+
+    // Number of leading digits in a little endian word: a byte is a digit iff its high nibble is 3 and its low nibble
+    // plus 6 does not overflow
+    static std::size_t CountDigits(const std::uint64_t word) {
+        const std::uint64_t high_nibbles = (word & 0xF0F0F0F0F0F0F0F0ull) ^ 0x3030303030303030ull;
+        const std::uint64_t low_nibbles =
+            ((word & 0x0F0F0F0F0F0F0F0Full) + 0x0606060606060606ull) & 0x1010101010101010ull;
+        const std::uint64_t non_digits = high_nibbles | low_nibbles;
+
+        // Set the most significant bit of each nonzero byte
+        const std::uint64_t nonzero_bytes =
+            (((non_digits & 0x7F7F7F7F7F7F7F7Full) + 0x7F7F7F7F7F7F7F7Full) | non_digits) & 0x8080808080808080ull;
+        return (nonzero_bytes != 0) ? __builtin_ctzll(nonzero_bytes) / 8 : kWordSize;
+    }
+
+    [[nodiscard]] std::uint64_t LoadWord(const std::size_t pos) const {
+        std::uint64_t word;
+        std::memcpy(&word, contents_ + pos, kWordSize);
+        return word;
+    }
+
+    // Converts the first `num_digits` <= 8 ASCII digits of a little endian word to their value with SWAR arithmetic:
+    // the digits are moved to the most significant bytes, then adjacent digits, pairs and quadruples are combined.
+    static std::uint64_t ParseWord(std::uint64_t word, const std::size_t num_digits) {
+        word -= 0x3030303030303030ull;
+        word <<= 8 * (kWordSize - num_digits);
+        word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FFull;
+        word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFFull;
+        word = (word * 10000 + (word >> 32)) & 0x00000000FFFFFFFFull;
+        return word;
+    }
+
     static int OpenFile(const std::string& filename) {
         const int file = open(filename.c_str(), O_RDONLY);
         if (file < 0) {
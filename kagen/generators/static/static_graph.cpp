@@ -1,12 +1,53 @@
 #include "kagen/generators/static/static_graph.h"
 
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <mpi.h>
+
 #include "kagen/generators/static/binary_parhip.h"
+#include "kagen/generators/static/edge_list.h"
 #include "kagen/generators/static/graph_reader.h"
+#include "kagen/generators/static/kagen_binary.h"
+#include "kagen/generators/static/manifest.h"
 #include "kagen/generators/static/metis.h"
+#include "kagen/tools/converter.h"
+#include "kagen/tools/postprocessor.h"
 
 namespace kagen {
 using namespace staticgraph;
 
+namespace {
+bool IsEdgeListFormat(const StaticGraphFormat format) {
+    return format == StaticGraphFormat::EDGE_LIST || format == StaticGraphFormat::BINARY_EDGE_LIST
+           || format == StaticGraphFormat::BINARY_EDGE_LIST32;
+}
+} // namespace
+
+PGeneratorConfig StaticGraphFactory::NormalizeParameters(
+    PGeneratorConfig config, const PEID rank, const PEID size, const bool output) const {
+    // METIS files and edge lists are only distributed during finalization
+    const bool is_edge_list = IsEdgeListFormat(config.static_graph.format);
+    if ((config.static_graph.format == StaticGraphFormat::METIS || is_edge_list) && config.skip_postprocessing) {
+        config.skip_postprocessing = false;
+        if (output) {
+            std::cout << "Warning: this input format is distributed during postprocessing, which cannot be skipped"
+                      << std::endl;
+        }
+    }
+    if (!is_edge_list && config.static_graph.symmetrize) {
+        config.static_graph.symmetrize = false;
+        if (output) {
+            std::cout << "Warning: only edge lists can be symmetrized; loading the graph as it is" << std::endl;
+        }
+    }
+
+    return GeneratorFactory::NormalizeParameters(std::move(config), rank, size, output);
+}
+
 std::unique_ptr<Generator> StaticGraphFactory::Create(const PGeneratorConfig& config, PEID rank, PEID size) const {
     return std::make_unique<StaticGraph>(config, rank, size);
 }
@@ -18,9 +59,19 @@ std::unique_ptr<GraphReader> CreateReader(const PGeneratorConfig& config) {
             return std::make_unique<MetisReader>(config.static_graph.filename);
         case StaticGraphFormat::BINARY_PARHIP:
             return std::make_unique<BinaryParhipReader>(config.static_graph.filename);
+        case StaticGraphFormat::KAGEN:
+            return std::make_unique<KaGenBinaryReader>(config.static_graph.filename);
+        case StaticGraphFormat::MANIFEST:
+            return std::make_unique<ManifestReader>(config.static_graph.filename);
+
+        case StaticGraphFormat::EDGE_LIST:
+        case StaticGraphFormat::BINARY_EDGE_LIST:
+        case StaticGraphFormat::BINARY_EDGE_LIST32:
+            // Edge lists are not read by vertex ranges, see StaticGraph::GenerateFromEdgeList()
+            throw IOError("edge lists cannot be read by vertex ranges");
     }
 
-    __builtin_unreachable();
+    throw IOError("unsupported input format");
 }
 
 std::pair<SInt, SInt> ComputeRange(const SInt n, const PEID size, const PEID rank) {
@@ -30,6 +81,126 @@ std::pair<SInt, SInt> ComputeRange(const SInt n, const PEID size, const PEID ran
     const SInt to    = std::min<SInt>(from + ((static_cast<SInt>(rank) < rem) ? chunk + 1 : chunk), n);
     return {from, to};
 }
+
+// Number of buckets of consecutive vertices per PE that are used to balance the edges of edge list inputs
+constexpr SInt kEdgeBalanceBucketsPerPE = 256;
+
+// Vertex range of PE `rank` such that all PEs get roughly the same number of `edges`, plus their reverse edges if
+// `symmetrize` is set: the edges are counted in buckets of consecutive vertices, and ranges are split at bucket
+// boundaries
+VertexRange ComputeEdgeBalancedRange(
+    const EdgeList& edges, const bool symmetrize, const SInt n, const PEID size, const PEID rank, MPI_Comm comm) {
+    if (n == 0) {
+        return {0, 0};
+    }
+
+    const SInt num_buckets  = std::min<SInt>(n, size * kEdgeBalanceBucketsPerPE);
+    const SInt bucket_width = (n + num_buckets - 1) / num_buckets;
+
+    // first_edge[b] is the number of edges in the buckets before bucket b
+    std::vector<SInt> first_edge(num_buckets + 1);
+    for (const auto& [tail, head]: edges) {
+        ++first_edge[tail / bucket_width + 1];
+        if (symmetrize) {
+            ++first_edge[head / bucket_width + 1];
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, first_edge.data(), num_buckets + 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    std::partial_sum(first_edge.begin(), first_edge.end(), first_edge.begin());
+
+    // A PE starts at the first bucket that is not before its share of the edges
+    auto range_start = [&](const PEID pe) {
+        const SInt edge   = ComputeRange(first_edge.back(), size, pe).first;
+        const SInt bucket = std::lower_bound(first_edge.begin(), first_edge.end(), edge) - first_edge.begin();
+        return std::min(bucket * bucket_width, n);
+    };
+    return {range_start(rank), rank + 1 < size ? range_start(rank + 1) : n};
+}
+
+// Maximum number of elements a PE sends resp. receives in one round of ExchangeSlices(), such that the counts and
+// displacements of MPI_Alltoallv() fit into an int
+constexpr SInt kMaxExchangeRoundSize = std::numeric_limits<int>::max() / 2;
+
+// Sends consecutive slices of `send_buf` to the PEs, `send_counts[pe]` elements to PE `pe`. If any PE sends or receives
+// more than kMaxExchangeRoundSize elements, the slices are split evenly into several rounds, each of which goes through
+// buffers holding only the elements of that round.
+template <typename T>
+std::vector<T>
+ExchangeSlices(const std::vector<T>& send_buf, const std::vector<SInt>& send_counts, MPI_Datatype type, MPI_Comm comm) {
+    PEID size;
+    MPI_Comm_size(comm, &size);
+
+    std::vector<SInt> send_displs(size);
+    std::vector<SInt> recv_counts(size);
+    std::vector<SInt> recv_displs(size);
+    std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), SInt{0});
+    MPI_Alltoall(send_counts.data(), 1, KAGEN_MPI_SINT, recv_counts.data(), 1, KAGEN_MPI_SINT, comm);
+    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), SInt{0});
+
+    const SInt     num_send = send_displs.back() + send_counts.back();
+    const SInt     num_recv = recv_displs.back() + recv_counts.back();
+    std::vector<T> recv_buf(num_recv);
+
+    SInt num_rounds = (std::max(num_send, num_recv) + kMaxExchangeRoundSize - 1) / kMaxExchangeRoundSize;
+    MPI_Allreduce(MPI_IN_PLACE, &num_rounds, 1, KAGEN_MPI_SINT, MPI_MAX, comm);
+
+    std::vector<int> round_send_counts(size);
+    std::vector<int> round_send_displs(size);
+    std::vector<int> round_recv_counts(size);
+    std::vector<int> round_recv_displs(size);
+    if (num_rounds <= 1) {
+        std::copy(send_counts.begin(), send_counts.end(), round_send_counts.begin());
+        std::copy(send_displs.begin(), send_displs.end(), round_send_displs.begin());
+        std::copy(recv_counts.begin(), recv_counts.end(), round_recv_counts.begin());
+        std::copy(recv_displs.begin(), recv_displs.end(), round_recv_displs.begin());
+        MPI_Alltoallv(
+            send_buf.data(), round_send_counts.data(), round_send_displs.data(), type, recv_buf.data(),
+            round_recv_counts.data(), round_recv_displs.data(), type, comm);
+        return recv_buf;
+    }
+
+    // Round r covers elements [count * r / num_rounds, count * (r + 1) / num_rounds) of each slice; both sides compute
+    // the same split, since they know the length of the slice
+    auto round_begin = [&](const SInt count, const SInt round) {
+        return count / num_rounds * round + count % num_rounds * round / num_rounds;
+    };
+
+    std::vector<T> round_send_buf;
+    std::vector<T> round_recv_buf;
+    for (SInt round = 0; round < num_rounds; ++round) {
+        round_send_buf.clear();
+        for (PEID pe = 0; pe < size; ++pe) {
+            const SInt begin      = round_begin(send_counts[pe], round);
+            const SInt end        = round_begin(send_counts[pe], round + 1);
+            round_send_counts[pe] = static_cast<int>(end - begin);
+            round_send_displs[pe] = static_cast<int>(round_send_buf.size());
+            round_send_buf.insert(
+                round_send_buf.end(), send_buf.begin() + send_displs[pe] + begin,
+                send_buf.begin() + send_displs[pe] + end);
+        }
+
+        int num_round_recv = 0;
+        for (PEID pe = 0; pe < size; ++pe) {
+            round_recv_counts[pe] =
+                static_cast<int>(round_begin(recv_counts[pe], round + 1) - round_begin(recv_counts[pe], round));
+            round_recv_displs[pe] = num_round_recv;
+            num_round_recv += round_recv_counts[pe];
+        }
+        round_recv_buf.resize(num_round_recv);
+
+        MPI_Alltoallv(
+            round_send_buf.data(), round_send_counts.data(), round_send_displs.data(), type, round_recv_buf.data(),
+            round_recv_counts.data(), round_recv_displs.data(), type, comm);
+
+        for (PEID pe = 0; pe < size; ++pe) {
+            std::copy_n(
+                round_recv_buf.begin() + round_recv_displs[pe], round_recv_counts[pe],
+                recv_buf.begin() + recv_displs[pe] + round_begin(recv_counts[pe], round));
+        }
+    }
+
+    return recv_buf;
+}
 } // namespace
 
 StaticGraph::StaticGraph(const PGeneratorConfig& config, const PEID rank, const PEID size)
@@ -45,7 +216,39 @@ void StaticGraph::GenerateCSR() {
     GenerateImpl(GraphRepresentation::CSR);
 }
 
+void StaticGraph::FinalizeEdgeList(MPI_Comm comm) {
+    if (edge_list_pending_) {
+        RedistributeEdgeList(comm);
+    }
+    if (metis_fragment_pending_) {
+        RedistributeMetisFragment(comm);
+        edges_ = BuildEdgeListFromCSR(vertex_range_, xadj_, adjncy_);
+        { [[maybe_unused]] auto _clear = std::move(xadj_); }
+        { [[maybe_unused]] auto _clear = std::move(adjncy_); }
+    }
+}
+
+void StaticGraph::FinalizeCSR(MPI_Comm comm) {
+    if (edge_list_pending_) {
+        RedistributeEdgeList(comm);
+        std::tie(xadj_, adjncy_) = BuildCSRFromEdgeList(vertex_range_, edges_, edge_weights_);
+        { [[maybe_unused]] auto _clear = std::move(edges_); }
+    }
+    if (metis_fragment_pending_) {
+        RedistributeMetisFragment(comm);
+    }
+}
+
 void StaticGraph::GenerateImpl(const GraphRepresentation representation) {
+    if (config_.static_graph.format == StaticGraphFormat::METIS) {
+        GenerateFromMetis();
+        return;
+    }
+    if (IsEdgeListFormat(config_.static_graph.format)) {
+        GenerateFromEdgeList();
+        return;
+    }
+
     auto reader       = CreateReader(config_);
     const auto [n, m] = reader->ReadSize();
 
@@ -69,8 +272,171 @@ void StaticGraph::GenerateImpl(const GraphRepresentation representation) {
     auto graph      = reader->Read(from, to_node, to_edge, representation);
     vertex_range_   = graph.vertex_range;
     edges_          = std::move(graph.edges);
+    xadj_           = std::move(graph.xadj);
+    adjncy_         = std::move(graph.adjncy);
     edge_weights_   = std::move(graph.edge_weights);
     vertex_weights_ = std::move(graph.vertex_weights);
     coordinates_    = std::move(graph.coordinates);
 }
+
+void StaticGraph::GenerateFromMetis() {
+    MetisReader reader(config_.static_graph.filename);
+    metis_num_vertices_ = reader.ReadSize().first;
+
+    auto fragment   = reader.ReadByteRange(rank_, size_);
+    vertex_range_   = {0, fragment.xadj.size() - 1};
+    xadj_           = std::move(fragment.xadj);
+    adjncy_         = std::move(fragment.adjncy);
+    vertex_weights_ = std::move(fragment.vertex_weights);
+    edge_weights_   = std::move(fragment.edge_weights);
+
+    metis_fragment_pending_ = true;
+}
+
+void StaticGraph::RedistributeMetisFragment(MPI_Comm comm) {
+    metis_fragment_pending_ = false;
+
+    const SInt n                  = metis_num_vertices_;
+    SInt       num_local_vertices = xadj_.size() - 1;
+
+    // Global IDs of the parsed vertices
+    SInt first_vertex = 0;
+    SInt num_parsed_vertices;
+    MPI_Exscan(&num_local_vertices, &first_vertex, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    MPI_Allreduce(&num_local_vertices, &num_parsed_vertices, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    if (rank_ == ROOT) {
+        first_vertex = 0;
+    }
+
+    if (num_parsed_vertices < n) {
+        throw IOError("input file contains fewer vertices than specified in its header");
+    }
+    if (num_parsed_vertices > n) {
+        if (rank_ == ROOT) {
+            std::cerr << "Warning: ignoring extra lines at the end of the input file\n";
+        }
+        num_local_vertices = std::min(num_local_vertices, n - std::min(first_vertex, n));
+        xadj_.resize(num_local_vertices + 1);
+        adjncy_.resize(xadj_.back());
+        if (!vertex_weights_.empty()) {
+            vertex_weights_.resize(num_local_vertices);
+        }
+        if (!edge_weights_.empty()) {
+            edge_weights_.resize(xadj_.back());
+        }
+    }
+
+    const SInt num_local_edges = adjncy_.size();
+    SInt       first_edge      = 0;
+    SInt       m;
+    MPI_Exscan(&num_local_edges, &first_edge, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    MPI_Allreduce(&num_local_edges, &m, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    if (rank_ == ROOT) {
+        first_edge = 0;
+    }
+
+    // A vertex is owned by the last PE whose range starts before its ID resp. its first edge, as with the other formats
+    const bool        balance_edges = config_.static_graph.distribution == StaticGraphDistribution::BALANCE_EDGES;
+    std::vector<SInt> range_starts(size_);
+    for (PEID pe = 0; pe < size_; ++pe) {
+        range_starts[pe] = ComputeRange(balance_edges ? m : n, size_, pe).first;
+    }
+    auto find_owner = [&](const SInt u) {
+        const SInt key = balance_edges ? first_edge + xadj_[u] : first_vertex + u;
+        return static_cast<PEID>(std::upper_bound(range_starts.begin(), range_starts.end(), key) - range_starts.begin())
+               - 1;
+    };
+
+    // Vertices are sent to their owners in consecutive slices; ranges[pe] is the first vertex owned by PE pe or later
+    std::vector<SInt> vertex_counts(size_);
+    std::vector<SInt> edge_counts(size_);
+    std::vector<SInt> ranges(size_ + 1, n);
+    PEID              next_owner = 0;
+    for (SInt u = 0; u < num_local_vertices; ++u) {
+        const PEID owner = find_owner(u);
+        ++vertex_counts[owner];
+        edge_counts[owner] += xadj_[u + 1] - xadj_[u];
+        for (; next_owner <= owner; ++next_owner) {
+            ranges[next_owner] = first_vertex + u;
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, ranges.data(), size_ + 1, KAGEN_MPI_SINT, MPI_MIN, comm);
+
+    bool has_vertex_weights = !vertex_weights_.empty();
+    bool has_edge_weights   = !edge_weights_.empty();
+    MPI_Allreduce(MPI_IN_PLACE, &has_vertex_weights, 1, MPI_CXX_BOOL, MPI_LOR, comm);
+    MPI_Allreduce(MPI_IN_PLACE, &has_edge_weights, 1, MPI_CXX_BOOL, MPI_LOR, comm);
+
+    std::vector<SInt> degrees(num_local_vertices);
+    for (SInt u = 0; u < num_local_vertices; ++u) {
+        degrees[u] = xadj_[u + 1] - xadj_[u];
+    }
+    degrees = ExchangeSlices(degrees, vertex_counts, KAGEN_MPI_SINT, comm);
+    adjncy_ = ExchangeSlices(adjncy_, edge_counts, KAGEN_MPI_VERTEXID, comm);
+    if (has_vertex_weights) {
+        vertex_weights_ = ExchangeSlices(vertex_weights_, vertex_counts, KAGEN_MPI_SSINT, comm);
+    }
+    if (has_edge_weights) {
+        edge_weights_ = ExchangeSlices(edge_weights_, edge_counts, KAGEN_MPI_SSINT, comm);
+    }
+
+    vertex_range_ = {ranges[rank_], ranges[rank_ + 1]};
+    xadj_.resize(degrees.size() + 1);
+    xadj_.front() = 0;
+    std::partial_sum(degrees.begin(), degrees.end(), xadj_.begin() + 1);
+}
+
+void StaticGraph::GenerateFromEdgeList() {
+    const auto& filename = config_.static_graph.filename;
+    auto        fragment = [&] {
+        switch (config_.static_graph.format) {
+            case StaticGraphFormat::BINARY_EDGE_LIST:
+                return BinaryEdgeListReader(filename, 64).ReadByteRange(rank_, size_);
+            case StaticGraphFormat::BINARY_EDGE_LIST32:
+                return BinaryEdgeListReader(filename, 32).ReadByteRange(rank_, size_);
+            default:
+                return EdgeListReader(filename).ReadByteRange(rank_, size_);
+        }
+    }();
+
+    vertex_range_           = {0, 0};
+    edges_                  = std::move(fragment.edges);
+    edge_list_num_vertices_ = fragment.num_vertices;
+    edge_list_pending_      = true;
+}
+
+void StaticGraph::RedistributeEdgeList(MPI_Comm comm) {
+    edge_list_pending_ = false;
+
+    // The number of vertices is recorded in the header of the file, if it has one; otherwise, it is one more than the
+    // largest vertex ID
+    SInt num_used_vertices = 0;
+    for (const auto& [tail, head]: edges_) {
+        num_used_vertices = std::max<SInt>(num_used_vertices, std::max(tail, head) + 1);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &num_used_vertices, 1, KAGEN_MPI_SINT, MPI_MAX, comm);
+
+    SInt n = edge_list_num_vertices_;
+    if (n == 0) {
+        n = num_used_vertices;
+    } else if (num_used_vertices > n) {
+        throw IOError("edge list contains vertex IDs that exceed the number of vertices specified in its header");
+    }
+
+    switch (config_.static_graph.distribution) {
+        case StaticGraphDistribution::BALANCE_VERTICES:
+            vertex_range_ = ComputeRange(n, size_, rank_);
+            break;
+
+        case StaticGraphDistribution::BALANCE_EDGES:
+            vertex_range_ = ComputeEdgeBalancedRange(edges_, config_.static_graph.symmetrize, n, size_, rank_, comm);
+            break;
+    }
+
+    if (config_.static_graph.symmetrize) {
+        AddReverseEdgesAndRedistribute(edges_, vertex_range_, config_.exchange_strategy, comm);
+    } else {
+        RedistributeEdges(edges_, vertex_range_, config_.exchange_strategy, comm);
+    }
+}
 } // namespace kagen
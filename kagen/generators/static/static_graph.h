@@ -5,6 +5,8 @@
 namespace kagen {
 class StaticGraphFactory : public GeneratorFactory {
 public:
+    PGeneratorConfig NormalizeParameters(PGeneratorConfig config, PEID rank, PEID size, bool output) const final;
+
     std::unique_ptr<Generator> Create(const PGeneratorConfig& config, PEID rank, PEID size) const final;
 };
 
@@ -17,12 +19,35 @@ protected:
 
     void GenerateCSR() final;
 
+    void FinalizeEdgeList(MPI_Comm comm) final;
+
+    void FinalizeCSR(MPI_Comm comm) final;
+
 private:
     void GenerateImpl(GraphRepresentation representation);
 
+    // METIS files are parsed in parallel: each PE parses the lines that start in its byte range of the file, numbering
+    // them from zero. The vertices are assigned their global IDs and redistributed according to the requested
+    // distribution during finalization.
+    void GenerateFromMetis();
+
+    void RedistributeMetisFragment(MPI_Comm comm);
+
+    // Edge lists are read in parallel as well: each PE reads the edges in its byte range of the file, which are sent to
+    // the owners of their tails during finalization.
+    void GenerateFromEdgeList();
+
+    void RedistributeEdgeList(MPI_Comm comm);
+
     const PGeneratorConfig& config_;
 
     PEID rank_;
     PEID size_;
+
+    bool metis_fragment_pending_ = false;
+    SInt metis_num_vertices_     = 0;
+
+    bool edge_list_pending_      = false;
+    SInt edge_list_num_vertices_ = 0;
 };
 } // namespace kagen
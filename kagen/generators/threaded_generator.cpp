@@ -0,0 +1,124 @@
+#include "kagen/generators/threaded_generator.h"
+#include "kagen/tools/converter.h"
+
+#include <algorithm>
+
+namespace kagen {
+namespace {
+template <typename Container, typename Member>
+void Concatenate(Container& result, std::vector<Graph>& graphs, Member member) {
+    std::vector<SInt> offsets(graphs.size() + 1);
+    for (std::size_t i = 0; i < graphs.size(); ++i) {
+        offsets[i + 1] = offsets[i] + (graphs[i].*member).size();
+    }
+    if (offsets.back() == 0) {
+        return;
+    }
+
+    result.resize(offsets.back());
+#pragma omp parallel for num_threads(graphs.size()) schedule(static, 1)
+    for (std::size_t i = 0; i < graphs.size(); ++i) {
+        auto& part = graphs[i].*member;
+        std::copy(part.begin(), part.end(), result.begin() + offsets[i]);
+        [[maybe_unused]] auto _free = std::move(part);
+    }
+}
+} // namespace
+
+ThreadedGenerator::ThreadedGenerator(
+    const GeneratorFactory& factory, const PGeneratorConfig& config, const PEID rank, const PEID size,
+    const int num_threads) {
+    for (int thread = 0; thread < num_threads; ++thread) {
+        generators_.push_back(factory.Create(config, rank * num_threads + thread, size * num_threads));
+    }
+}
+
+void ThreadedGenerator::SetMemoryLimit(const SInt memory_limit, std::string scratch_directory, MPI_Comm comm) {
+    const SInt memory_limit_per_thread =
+        (memory_limit > 0) ? std::max<SInt>(memory_limit / generators_.size(), 1) : 0;
+    for (auto& generator: generators_) {
+        generator->SetMemoryLimit(memory_limit_per_thread, scratch_directory, comm);
+    }
+}
+
+std::vector<Graph> ThreadedGenerator::GenerateParts(const GraphRepresentation representation) {
+    const int          num_threads = static_cast<int>(generators_.size());
+    std::vector<Graph> graphs(num_threads);
+
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (int thread = 0; thread < num_threads; ++thread) {
+        generators_[thread]->Generate(representation);
+        graphs[thread] = generators_[thread]->Take();
+    }
+
+    SetVertexRange(graphs.front().vertex_range.first, graphs.back().vertex_range.second);
+    vertex_id_overflow_ = std::any_of(generators_.begin(), generators_.end(), [](const auto& generator) {
+        return generator->HasVertexIDOverflow();
+    });
+    return graphs;
+}
+
+void ThreadedGenerator::GenerateEdgeList() {
+    std::vector<Graph> graphs = GenerateParts(GraphRepresentation::EDGE_LIST);
+    Concatenate(edges_, graphs, &Graph::edges);
+    Concatenate(edge_weights_, graphs, &Graph::edge_weights);
+    ConcatenateVertexInformation(graphs);
+}
+
+void ThreadedGenerator::GenerateCSR() {
+    std::vector<Graph> graphs = GenerateParts(GraphRepresentation::CSR);
+
+    // Generators without native CSR support only build their CSR representation during finalization
+    for (auto& graph: graphs) {
+        if (graph.xadj.empty()) {
+            std::tie(graph.xadj, graph.adjncy) =
+                BuildCSRFromEdgeList(graph.vertex_range, graph.edges, graph.edge_weights);
+            [[maybe_unused]] auto _free = std::move(graph.edges);
+        }
+    }
+
+    // Shift each xadj fragment by the number of edges in preceding fragments; the last entry of each fragment is
+    // replaced by the first entry of the next one
+    std::vector<SInt> node_offsets(graphs.size() + 1);
+    std::vector<SInt> edge_offsets(graphs.size() + 1);
+    for (std::size_t i = 0; i < graphs.size(); ++i) {
+        node_offsets[i + 1] = node_offsets[i] + graphs[i].vertex_range.second - graphs[i].vertex_range.first;
+        edge_offsets[i + 1] = edge_offsets[i] + graphs[i].adjncy.size();
+    }
+
+    xadj_.resize(node_offsets.back() + 1);
+    xadj_.back() = edge_offsets.back();
+#pragma omp parallel for num_threads(graphs.size()) schedule(static, 1)
+    for (std::size_t i = 0; i < graphs.size(); ++i) {
+        auto& xadj = graphs[i].xadj;
+        std::transform(xadj.begin(), xadj.end() - 1, xadj_.begin() + node_offsets[i], [&](const SInt offset) {
+            return offset + edge_offsets[i];
+        });
+        [[maybe_unused]] auto _free = std::move(xadj);
+    }
+
+    Concatenate(adjncy_, graphs, &Graph::adjncy);
+    Concatenate(edge_weights_, graphs, &Graph::edge_weights);
+    ConcatenateVertexInformation(graphs);
+}
+
+void ThreadedGenerator::ConcatenateVertexInformation(std::vector<Graph>& graphs) {
+    Concatenate(vertex_weights_, graphs, &Graph::vertex_weights);
+    for (auto& graph: graphs) {
+        coordinates_.first.insert(
+            coordinates_.first.end(), graph.coordinates.first.begin(), graph.coordinates.first.end());
+        coordinates_.second.insert(
+            coordinates_.second.end(), graph.coordinates.second.begin(), graph.coordinates.second.end());
+    }
+}
+
+int ComputeNumberOfThreads(const GeneratorFactory& factory, const PGeneratorConfig& config, const PEID size) {
+    if (config.num_threads <= 1 || !factory.IsCommunicationFree()) {
+        return 1;
+    }
+    if (config.k == 0) {
+        return config.num_threads;
+    }
+    return static_cast<int>(std::clamp<SInt>(config.k / size, 1, config.num_threads));
+}
+} // namespace kagen
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/generators/generator.h"
+
+namespace kagen {
+// Generates the local subgraph of a PE with multiple threads. Each thread acts as a virtual PE, i.e., the chunks
+// assigned to this PE are split among `num_threads` instances of the actual generator, which are run concurrently.
+// Since consecutive virtual PEs own consecutive vertex ranges, their edge lists resp. CSR fragments are merged by
+// concatenation. Only applicable to communication-free generators, see GeneratorFactory::IsCommunicationFree().
+class ThreadedGenerator : public virtual Generator {
+public:
+    ThreadedGenerator(
+        const GeneratorFactory& factory, const PGeneratorConfig& config, PEID rank, PEID size, int num_threads);
+
+    // Each thread gets an equal share of the memory limit. Since the generators are communication-free, the spilled
+    // edges of each thread are merged back into memory before the fragments are concatenated.
+    void SetMemoryLimit(SInt memory_limit, std::string scratch_directory, MPI_Comm comm) final;
+
+protected:
+    void GenerateEdgeList() final;
+
+    void GenerateCSR() final;
+
+private:
+    std::vector<Graph> GenerateParts(GraphRepresentation representation);
+
+    void ConcatenateVertexInformation(std::vector<Graph>& graphs);
+
+    std::vector<std::unique_ptr<Generator>> generators_;
+};
+
+// Number of threads that can be used to generate the local subgraph: all requested threads if the number of chunks is
+// chosen automatically, otherwise at most one thread per chunk.
+int ComputeNumberOfThreads(const GeneratorFactory& factory, const PGeneratorConfig& config, PEID size);
+} // namespace kagen
@@ -1,13 +1,18 @@
 #include "kagen/io/binary_parhip.h"
 
 #include <algorithm>
-#include <fstream>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
 
 #include <mpi.h>
 
 #include "kagen/io/buffered_writer.h"
 #include "kagen/io/graph_writer.h"
+#include "kagen/io/mpi_io.h"
+#include "kagen/tools/radix_sort.h"
 #include "kagen/tools/statistics.h"
+#include "kagen/tools/zip_iterator.h"
 
 namespace kagen {
 using ParHipID     = unsigned long long;
@@ -32,39 +37,43 @@ void BinaryParHipWriter::Write(const PGeneratorConfig& config) {
             << "Warning: this file format does not support distributed output; writing the graph to a single file."
             << std::endl;
     }
+    if (config.output_compression != OutputCompression::NONE && output) {
+        std::cout << "Warning: this file format does not support compression; writing the graph uncompressed."
+                  << std::endl;
+    }
 
     // Edges must be sorted in order to convert them to the CSR format
     if (!std::is_sorted(edges_.begin(), edges_.end())) {
-        std::sort(edges_.begin(), edges_.end());
+        if (HasEdgeWeights()) {
+            ZipSort(edges_, edge_weights_);
+        } else {
+            RadixSortEdges(edges_, config.num_threads);
+        }
     }
 
     const ParHipID num_global_vertices = FindNumberOfGlobalNodes(vertex_range_, comm_);
     const ParHipID num_global_edges    = FindNumberOfGlobalEdges(edges_, comm_);
 
-    // Header
-    if (rank == ROOT && config.output_header != OutputHeader::NEVER) {
-        // To be compatible with the original format used by ParHiP, we use the following versions:
-        // 3 = no vertex or edge weights = compatible with ParHiP
-        // 2 = no vertex weights, but edge weights
-        // 1 = vertex weights, but no edge weights
-        // 0 = vertex weights and edge weights
-        // I.e., the negated "format" code used by the Metis format
-        const ParHipID vertex_weights_bit = (static_cast<SInt>(HasVertexWeights()) ^ 1) << 1;
-        const ParHipID edge_weights_bit   = static_cast<SInt>(HasEdgeWeights()) ^ 1;
-        const ParHipID version            = vertex_weights_bit | edge_weights_bit;
-
-        std::ofstream out(filename, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc);
-        out.write(reinterpret_cast<const char*>(&version), sizeof(ParHipID));
-        out.write(reinterpret_cast<const char*>(&num_global_vertices), sizeof(ParHipID));
-        out.write(reinterpret_cast<const char*>(&num_global_edges), sizeof(ParHipID));
+    // Each PE writes its part of every section of the file; vertex ranges are consecutive, thus, the position of a part
+    // is determined by the number of vertices and edges on the preceding PEs
+    const SInt num_local_vertices = vertex_range_.second - vertex_range_.first;
+    const SInt num_local_edges    = edges_.size();
+    SInt       first_local_edge   = 0;
+    MPI_Exscan(&num_local_edges, &first_local_edge, 1, KAGEN_MPI_SINT, MPI_SUM, comm_);
+    if (rank == ROOT) {
+        first_local_edge = 0;
     }
 
-    // Generate the CSR data
-    const SInt            num_local_vertices = vertex_range_.second - vertex_range_.first;
-    std::vector<ParHipID> offset(num_local_vertices + 1);
-    std::vector<ParHipID> edges(edges_.size());
+    const bool       write_header = config.output_header != OutputHeader::NEVER;
+    const MPI_Offset offsets_pos  = (write_header ? 3 : 0) * sizeof(ParHipID);
+    const MPI_Offset edges_pos    = offsets_pos + (num_global_vertices + 1) * sizeof(ParHipID);
+    const MPI_Offset weights_pos  = edges_pos + num_global_edges * sizeof(ParHipID);
+
+    // Generate the CSR data; the last PE also writes the offset one past the last vertex
+    std::vector<ParHipID> offset(num_local_vertices + (rank + 1 == size));
+    std::vector<ParHipID> edges(num_local_edges);
 
-    SInt cur_offset = (3 + num_global_vertices + 1) * sizeof(ParHipID); // 3 = header size
+    SInt cur_offset = (3 + num_global_vertices + 1 + first_local_edge) * sizeof(ParHipID); // 3 = header size
     SInt cur_edge   = 0;
     SInt cur_vertex = 0;
     for (SInt from = vertex_range_.first; from < vertex_range_.second; ++from) {
@@ -80,42 +89,56 @@ void BinaryParHipWriter::Write(const PGeneratorConfig& config) {
         cur_offset += degree * sizeof(ParHipID);
         ++cur_vertex;
     }
-    offset[cur_vertex] = cur_offset;
-
-    // Write graph to binary file
-    auto output_loop = [&](auto&& action) {
-        for (PEID pe = 0; pe < size; ++pe) {
-            if (pe == rank) {
-                std::ofstream out(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
-                action(out);
-            }
-            MPI_Barrier(comm_);
+    if (rank + 1 == size) {
+        offset[cur_vertex] = cur_offset;
+    }
+
+    // Write graph to binary file: all PEs write concurrently
+    MPI_File file;
+    if (MPI_File_open(comm_, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file)
+        != MPI_SUCCESS) {
+        if (rank == ROOT) {
+            std::cerr << "Error: cannot write to " << filename << "\n";
         }
-    };
+        std::exit(1);
+    }
+    MPI_File_set_size(file, 0);
 
-    // Write offset array
-    output_loop([&offset](std::ofstream& out) {
-        out.write(reinterpret_cast<const char*>(offset.data()), offset.size() * sizeof(ParHipID));
-    });
+    // Header
+    if (write_header) {
+        // To be compatible with the original format used by ParHiP, we use the following versions:
+        // 3 = no vertex or edge weights = compatible with ParHiP
+        // 2 = no vertex weights, but edge weights
+        // 1 = vertex weights, but no edge weights
+        // 0 = vertex weights and edge weights
+        // I.e., the negated "format" code used by the Metis format
+        const ParHipID vertex_weights_bit = (static_cast<SInt>(HasVertexWeights()) ^ 1) << 1;
+        const ParHipID edge_weights_bit   = static_cast<SInt>(HasEdgeWeights()) ^ 1;
+        const ParHipID version            = vertex_weights_bit | edge_weights_bit;
 
-    // Write edges array
-    output_loop([&edges](std::ofstream& out) {
-        out.write(reinterpret_cast<const char*>(edges.data()), edges.size() * sizeof(ParHipID));
-    });
+        std::vector<ParHipID> header;
+        if (rank == ROOT) {
+            header = {version, num_global_vertices, num_global_edges};
+        }
+        WriteAtAll(file, 0, header, comm_);
+    }
+
+    // Write offset and edges array
+    WriteAtAll(file, offsets_pos + vertex_range_.first * sizeof(ParHipID), offset, comm_);
+    WriteAtAll(file, edges_pos + first_local_edge * sizeof(ParHipID), edges, comm_);
 
-    // Write  weights
+    // Write weights
     static_assert(std::is_same_v<SSInt, ParHipWeight>); // @todo create copy if the data types do not match
 
+    const MPI_Offset edge_weights_pos =
+        weights_pos + (HasVertexWeights() ? num_global_vertices : 0) * sizeof(ParHipWeight);
     if (HasVertexWeights()) {
-        output_loop([this](std::ofstream& out) {
-            out.write(
-                reinterpret_cast<const char*>(vertex_weights_.data()), vertex_weights_.size() * sizeof(ParHipWeight));
-        });
+        WriteAtAll(file, weights_pos + vertex_range_.first * sizeof(ParHipWeight), vertex_weights_, comm_);
     }
     if (HasEdgeWeights()) {
-        output_loop([this](std::ofstream& out) {
-            out.write(reinterpret_cast<const char*>(edge_weights_.data()), edge_weights_.size() * sizeof(ParHipWeight));
-        });
+        WriteAtAll(file, edge_weights_pos + first_local_edge * sizeof(ParHipWeight), edge_weights_, comm_);
     }
+
+    MPI_File_close(&file);
 }
 } // namespace kagen
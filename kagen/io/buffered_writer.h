@@ -1,42 +1,100 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "kagen/io/checksum.h"
+#include "kagen/io/compression.h"
+
 namespace kagen {
 struct CreateTag {};
 struct AppendTag {};
+struct WriteAtTag {};
+struct MemoryTag {};
+struct CountTag {};
 
 namespace tag {
-constexpr CreateTag create;
-constexpr AppendTag append;
+constexpr CreateTag  create;
+constexpr AppendTag  append;
+constexpr WriteAtTag write_at; // Write to an existing file, starting at a given byte offset
+constexpr MemoryTag  memory;   // Append to a buffer in memory instead of a file
+constexpr CountTag   count;    // Only count the number of bytes that would be written
 } // namespace tag
 
+// Output is formatted into one buffer while the other buffer is written to the file by a background I/O thread, which
+// is started once the first buffer is full. Thus, formatting and writing overlap. If a compressor is given, the output
+// is compressed before it is written, also by the I/O thread.
 template <std::size_t kBufferSize = 1024 * 1024, std::size_t kBufferSizeLimit = kBufferSize - 1024>
 class BufferedTextOutput {
 public:
-    BufferedTextOutput(CreateTag, const std::string& filename)
-        : fd_{open(filename.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR)} {
+    BufferedTextOutput(CreateTag, const std::string& filename, std::unique_ptr<Compressor> compressor = nullptr)
+        : fd_{open(filename.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR)},
+          compressor_{std::move(compressor)} {
         if (fd_ < 0) {
             std::cout << "cannot write to " << filename << std::endl;
             std::exit(0);
         }
     }
 
-    BufferedTextOutput(AppendTag, const std::string& filename) : fd_{open(filename.c_str(), O_WRONLY | O_APPEND)} {
+    // If given, `checksum` is updated with the bytes written to the file, i.e., after compression
+    BufferedTextOutput(
+        AppendTag, const std::string& filename, std::unique_ptr<Compressor> compressor = nullptr,
+        IncrementalChecksum* checksum = nullptr)
+        : fd_{open(filename.c_str(), O_WRONLY | O_APPEND)},
+          compressor_{std::move(compressor)},
+          checksum_{checksum} {
         if (fd_ < 0) {
             std::cout << "cannot write to " << filename << std::endl;
             std::exit(0);
         }
     }
 
+    BufferedTextOutput(WriteAtTag, const std::string& filename, const std::size_t offset)
+        : fd_{open(filename.c_str(), O_WRONLY)},
+          offset_{offset} {
+        if (fd_ < 0) {
+            std::cout << "cannot write to " << filename << std::endl;
+            std::exit(0);
+        }
+    }
+
+    // Appends the (compressed) output to `memory`, e.g., to find its size before writing it to a file
+    BufferedTextOutput(MemoryTag, std::vector<char>& memory, std::unique_ptr<Compressor> compressor = nullptr)
+        : fd_{-1},
+          compressor_{std::move(compressor)},
+          memory_{&memory} {}
+
+    explicit BufferedTextOutput(CountTag) : fd_{-1} {}
+
+    BufferedTextOutput(const BufferedTextOutput&)            = delete;
+    BufferedTextOutput& operator=(const BufferedTextOutput&) = delete;
+
     ~BufferedTextOutput() {
+        StopIOThread();
         ForceFlush();
-        close(fd_);
+        if (compressor_ != nullptr) {
+            compressed_.clear();
+            compressor_->Finish(compressed_);
+            WriteBytes(compressed_.data(), compressed_.size(), num_flushed_bytes_);
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
     }
 
     BufferedTextOutput& WriteString(const char* str) {
@@ -52,42 +110,296 @@ public:
     }
 
     template <typename Int>
-    BufferedTextOutput& WriteInt(Int value) {
-        static char rev_buffer[80];
+    BufferedTextOutput& WriteInt(const Int value) {
+        std::uint64_t abs_value = static_cast<std::uint64_t>(value);
+        if constexpr (std::is_signed_v<Int>) {
+            if (value < 0) {
+                WriteChar('-');
+                abs_value = 0 - abs_value;
+            }
+        }
+        buffer_pos_ = FormatUnsigned(buffer_pos_, abs_value, CountDigits(abs_value));
+        return *this;
+    }
 
-        int pos = 0;
-        do {
-            rev_buffer[pos++] = value % 10;
-            value /= 10;
-        } while (value > 0);
+    // Same output as printf("%.5f", value)
+    BufferedTextOutput& WriteFloat(const double value) {
+        // Fall back to sprintf() if the integral part does not fit into the exact range of double
+        if (!std::isfinite(value) || std::abs(value) >= kMaxFastFloat) {
+            buffer_pos_ += std::sprintf(buffer_pos_, "%.5lf", value);
+            return *this;
+        }
+        if (std::signbit(value)) {
+            WriteChar('-');
+        }
 
-        while (pos > 0) {
-            *(buffer_pos_++) = '0' + rev_buffer[--pos];
+        const double  abs_value = std::abs(value);
+        std::uint64_t integral  = static_cast<std::uint64_t>(abs_value);
+
+        // The subtraction is exact, but the scaling might round the product to a tie: in this case, the rounding error
+        // decides which way to round, like printf() does on the exact value
+        const double fraction = abs_value - integral;
+        const double scaled   = fraction * kFloatScale;
+        double       rounded  = std::nearbyint(scaled);
+        if (scaled - std::floor(scaled) == 0.5) {
+            const double error = std::fma(fraction, static_cast<double>(kFloatScale), -scaled);
+            if (error > 0) {
+                rounded = std::ceil(scaled);
+            } else if (error < 0) {
+                rounded = std::floor(scaled);
+            }
+        }
+
+        std::uint64_t fractional = static_cast<std::uint64_t>(rounded);
+        if (fractional == kFloatScale) {
+            ++integral;
+            fractional = 0;
         }
+
+        buffer_pos_    = FormatUnsigned(buffer_pos_, integral, CountDigits(integral));
+        *buffer_pos_++ = '.';
+        buffer_pos_    = FormatUnsigned(buffer_pos_, fractional, kFloatPrecision);
         return *this;
     }
 
-    BufferedTextOutput& WriteFloat(const double value) {
-        int written = std::sprintf(buffer_pos_, "%.5lf", value);
-        buffer_pos_ += written;
+    // Writes binary data; unlike the other Write*() functions, this may also be used for data larger than the buffer.
+    // Data that is at least as large as the buffer is written directly, without copying it to the buffer first.
+    BufferedTextOutput& WriteRaw(const void* data, std::size_t size) {
+        const char* pos = static_cast<const char*>(data);
+        if (size >= kBufferSize) {
+            StartFlush();
+            WaitForFlush();
+            WriteToFile(pos, size, num_flushed_bytes_);
+            num_flushed_bytes_ += size;
+            return *this;
+        }
+
+        while (size > 0) {
+            const std::size_t chunk = std::min<std::size_t>(size, buffer_ + kBufferSize - buffer_pos_);
+            std::memcpy(buffer_pos_, pos, chunk);
+            buffer_pos_ += chunk;
+            pos += chunk;
+            size -= chunk;
+            Flush();
+        }
         return *this;
     }
 
+    // Number of bytes written so far, including bytes that are still buffered
+    std::size_t GetNumberOfBytes() const {
+        return num_flushed_bytes_ + (buffer_pos_ - buffer_);
+    }
+
     BufferedTextOutput& Flush() {
         if (static_cast<std::size_t>(buffer_pos_ - buffer_) >= kBufferSizeLimit) {
-            ForceFlush();
+            StartFlush();
         }
         return *this;
     }
 
 private:
+    // Synchronously writes the buffer; only used once the I/O thread has stopped
     void ForceFlush() {
-        [[maybe_unused]] auto nbytes_writte = write(fd_, buffer_, buffer_pos_ - buffer_);
-        buffer_pos_                         = buffer_;
+        const std::size_t size = buffer_pos_ - buffer_;
+        WriteToFile(buffer_, size, num_flushed_bytes_);
+        num_flushed_bytes_ += size;
+        buffer_pos_ = buffer_;
     }
 
-    int   fd_;
-    char  buffer_[kBufferSize]{0};
-    char* buffer_pos_{buffer_};
+    // Hands the buffer over to the I/O thread and continues with the other buffer
+    void StartFlush() {
+        // Without a second core, writing would not overlap with formatting
+        static const bool use_io_thread = std::thread::hardware_concurrency() > 1;
+        if ((fd_ < 0 && memory_ == nullptr) || !use_io_thread) {
+            ForceFlush();
+            return;
+        }
+        if (!io_thread_.joinable()) {
+            back_buffer_ = std::make_unique<char[]>(kBufferSize);
+            io_thread_   = std::thread([this] { RunIOThread(); });
+        }
+
+        WaitForFlush();
+
+        const std::size_t size = buffer_pos_ - buffer_;
+        {
+            std::lock_guard lock(mutex_);
+            pending_data_     = buffer_;
+            pending_size_     = size;
+            pending_position_ = num_flushed_bytes_;
+            has_pending_      = true;
+        }
+        cv_.notify_all();
+
+        num_flushed_bytes_ += size;
+        std::swap(front_buffer_, back_buffer_);
+        buffer_     = front_buffer_.get();
+        buffer_pos_ = buffer_;
+    }
+
+    void WaitForFlush() {
+        if (io_thread_.joinable()) {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [&] { return !has_pending_; });
+        }
+    }
+
+    void StopIOThread() {
+        if (io_thread_.joinable()) {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            io_thread_.join();
+        }
+    }
+
+    void RunIOThread() {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [&] { return has_pending_ || stop_; });
+            if (has_pending_) {
+                lock.unlock();
+                WriteToFile(pending_data_, pending_size_, pending_position_);
+                lock.lock();
+                has_pending_ = false;
+                cv_.notify_all();
+            } else {
+                return;
+            }
+        }
+    }
+
+    void WriteToFile(const char* data, const std::size_t size, const std::size_t position) {
+        if (compressor_ != nullptr) {
+            compressed_.clear();
+            compressor_->Compress(data, size, compressed_);
+            WriteBytes(compressed_.data(), compressed_.size(), position);
+        } else {
+            WriteBytes(data, size, position);
+        }
+    }
+
+    // Writes `data` to byte `position` of our output, i.e., to byte `offset_ + position` of the file if it was opened
+    // with an offset, otherwise to the current end of the file resp. memory buffer
+    void WriteBytes(const char* data, const std::size_t size, const std::size_t position) const {
+        if (checksum_ != nullptr) {
+            checksum_->Update(data, size);
+        }
+        if (memory_ != nullptr) {
+            memory_->insert(memory_->end(), data, data + size);
+        } else if (fd_ >= 0 && offset_ != kNoOffset) {
+            for (std::size_t written = 0; written < size;) {
+                const auto nbytes = pwrite(fd_, data + written, size - written, offset_ + position + written);
+                if (nbytes <= 0) {
+                    break;
+                }
+                written += nbytes;
+            }
+        } else if (fd_ >= 0) {
+            for (std::size_t written = 0; written < size;) {
+                const auto nbytes = write(fd_, data + written, size - written);
+                if (nbytes <= 0) {
+                    break;
+                }
+                written += nbytes;
+            }
+        }
+    }
+
+    // Number of decimal digits of `value`: the bit length gives an estimate (log10(2) ~= 1233 / 4096) that is at most
+    // one too large. Setting the lowest bit does not change the number of digits, but maps 0 to 1.
+    static int CountDigits(std::uint64_t value) {
+        value |= 1;
+        const int bits     = 64 - __builtin_clzll(value);
+        const int estimate = (bits * 1233) >> 12;
+        return estimate + 1 - (value < kPowersOf10[estimate]);
+    }
+
+    // Writes the `digits` least significant decimal digits of `value`, two at a time from right to left, i.e., pads
+    // with leading zeros; returns the position after the last digit
+    static char* FormatUnsigned(char* const pos, std::uint64_t value, const int digits) {
+        char* cur = pos + digits;
+        while (cur - pos >= 2) {
+            cur -= 2;
+            std::memcpy(cur, kDigitPairs + (value % 100) * 2, 2);
+            value /= 100;
+        }
+        if (cur > pos) {
+            *pos = static_cast<char>('0' + value % 10);
+        }
+        return pos + digits;
+    }
+
+    static constexpr char kDigitPairs[] = "00010203040506070809"
+                                          "10111213141516171819"
+                                          "20212223242526272829"
+                                          "30313233343536373839"
+                                          "40414243444546474849"
+                                          "50515253545556575859"
+                                          "60616263646566676869"
+                                          "70717273747576777879"
+                                          "80818283848586878889"
+                                          "90919293949596979899";
+
+    static constexpr std::uint64_t kPowersOf10[] = {
+        1ull,
+        10ull,
+        100ull,
+        1000ull,
+        10000ull,
+        100000ull,
+        1000000ull,
+        10000000ull,
+        100000000ull,
+        1000000000ull,
+        10000000000ull,
+        100000000000ull,
+        1000000000000ull,
+        10000000000000ull,
+        100000000000000ull,
+        1000000000000000ull,
+        10000000000000000ull,
+        100000000000000000ull,
+        1000000000000000000ull,
+        10000000000000000000ull,
+    };
+
+    // WriteFloat() prints this many decimal places
+    static constexpr int           kFloatPrecision = 5;
+    static constexpr std::uint64_t kFloatScale     = kPowersOf10[kFloatPrecision];
+    static constexpr double        kMaxFastFloat   = 1e15;
+
+    static constexpr std::size_t kNoOffset = static_cast<std::size_t>(-1);
+
+    int         fd_;
+    std::size_t offset_            = kNoOffset;
+    std::size_t num_flushed_bytes_ = 0;
+
+    // Compressed output; only supported without offset
+    std::unique_ptr<Compressor> compressor_;
+    std::vector<char>           compressed_;
+
+    // Bytes are written in the order of their position in the file, either by the I/O thread or after it has finished
+    IncrementalChecksum* checksum_ = nullptr;
+
+    // Output buffer in memory, see tag::memory
+    std::vector<char>* memory_ = nullptr;
+
+    std::unique_ptr<char[]> front_buffer_ = std::make_unique<char[]>(kBufferSize);
+    std::unique_ptr<char[]> back_buffer_;
+    char*                   buffer_     = front_buffer_.get();
+    char*                   buffer_pos_ = buffer_;
+
+    // Shared with the I/O thread
+    std::thread             io_thread_;
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+    const char*             pending_data_     = nullptr;
+    std::size_t             pending_size_     = 0;
+    std::size_t             pending_position_ = 0;
+    bool                    has_pending_      = false;
+    bool                    stop_             = false;
 };
 } // namespace kagen
@@ -0,0 +1,70 @@
+#include "kagen/io/checksum.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace kagen {
+namespace {
+constexpr std::uint64_t kChecksumOffsetBasis = 14695981039346656037ull;
+constexpr std::uint64_t kChecksumPrime       = 1099511628211ull;
+
+std::uint64_t UpdateChecksum(std::uint64_t hash, const char* data, const std::size_t size) {
+    const std::size_t num_words = size / sizeof(std::uint64_t);
+    for (std::size_t i = 0; i < num_words; ++i) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i * sizeof(std::uint64_t), sizeof(std::uint64_t));
+        hash = (hash ^ word) * kChecksumPrime;
+    }
+
+    const std::size_t rest = size - num_words * sizeof(std::uint64_t);
+    if (rest > 0) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data + num_words * sizeof(std::uint64_t), rest);
+        hash = (hash ^ word) * kChecksumPrime;
+    }
+
+    return hash;
+}
+} // namespace
+
+std::uint64_t ComputeChecksum(const char* data, const std::size_t size) {
+    return UpdateChecksum(kChecksumOffsetBasis, data, size);
+}
+
+IncrementalChecksum::IncrementalChecksum() : hash_(kChecksumOffsetBasis) {}
+
+void IncrementalChecksum::Update(const char* data, std::size_t size) {
+    num_bytes_ += size;
+
+    // Complete the partial word of the previous call first
+    if (num_pending_ > 0) {
+        const std::size_t count = std::min(size, sizeof(std::uint64_t) - num_pending_);
+        std::memcpy(pending_ + num_pending_, data, count);
+        num_pending_ += count;
+        data += count;
+        size -= count;
+
+        if (num_pending_ < sizeof(std::uint64_t)) {
+            return;
+        }
+        hash_        = UpdateChecksum(hash_, pending_, sizeof(std::uint64_t));
+        num_pending_ = 0;
+    }
+
+    const std::size_t num_full_bytes = size / sizeof(std::uint64_t) * sizeof(std::uint64_t);
+    hash_                            = UpdateChecksum(hash_, data, num_full_bytes);
+
+    num_pending_ = size - num_full_bytes;
+    if (num_pending_ > 0) {
+        std::memcpy(pending_, data + num_full_bytes, num_pending_);
+    }
+}
+
+std::uint64_t IncrementalChecksum::GetNumberOfBytes() const {
+    return num_bytes_;
+}
+
+std::uint64_t IncrementalChecksum::GetChecksum() const {
+    return UpdateChecksum(hash_, pending_, num_pending_);
+}
+} // namespace kagen
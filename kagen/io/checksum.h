@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace kagen {
+// Checksum of `size` bytes: 64 bit FNV-1a over 8 byte words, with the last partial word padded with zeros.
+std::uint64_t ComputeChecksum(const char* data, std::size_t size);
+
+// Computes ComputeChecksum() of data that is passed in consecutive pieces of arbitrary sizes, e.g., while it is written
+// to a file, see BufferedTextOutput.
+class IncrementalChecksum {
+public:
+    IncrementalChecksum();
+
+    void Update(const char* data, std::size_t size);
+
+    // Number of bytes passed to Update() so far
+    std::uint64_t GetNumberOfBytes() const;
+
+    // Checksum of all bytes passed to Update() so far
+    std::uint64_t GetChecksum() const;
+
+private:
+    std::uint64_t hash_;
+    std::uint64_t num_bytes_ = 0;
+
+    // Bytes of the current partial word
+    char        pending_[sizeof(std::uint64_t)];
+    std::size_t num_pending_ = 0;
+};
+} // namespace kagen
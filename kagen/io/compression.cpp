@@ -0,0 +1,195 @@
+#include "kagen/io/compression.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#ifdef KAGEN_ZLIB_FOUND
+    #include <zlib.h>
+#endif // KAGEN_ZLIB_FOUND
+#ifdef KAGEN_ZSTD_FOUND
+    #include <zstd.h>
+#endif // KAGEN_ZSTD_FOUND
+
+namespace kagen {
+namespace {
+// Output space that is reserved at once for the compressed data
+constexpr std::size_t kOutputChunkSize = 1 << 16;
+
+#ifdef KAGEN_ZLIB_FOUND
+// Favor throughput: compression should keep up with formatting
+constexpr int kGzipLevel = 1;
+
+class GzipCompressor : public Compressor {
+public:
+    GzipCompressor() {
+        // 15 + 16: largest window size and gzip instead of zlib header
+        if (deflateInit2(&stream_, kGzipLevel, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            std::cerr << "cannot initialize gzip compression" << std::endl;
+            std::exit(1);
+        }
+    }
+
+    GzipCompressor(const GzipCompressor&)            = delete;
+    GzipCompressor& operator=(const GzipCompressor&) = delete;
+
+    ~GzipCompressor() override {
+        deflateEnd(&stream_);
+    }
+
+    void Compress(const char* data, std::size_t size, std::vector<char>& out) override {
+        // avail_in only has 32 bits
+        constexpr std::size_t kMaxInputSize = 1 << 30;
+        while (size > 0) {
+            const std::size_t chunk = std::min(size, kMaxInputSize);
+            stream_.next_in         = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+            stream_.avail_in        = static_cast<uInt>(chunk);
+            Deflate(Z_NO_FLUSH, out);
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    void Finish(std::vector<char>& out) override {
+        stream_.next_in  = nullptr;
+        stream_.avail_in = 0;
+        Deflate(Z_FINISH, out);
+    }
+
+private:
+    void Deflate(const int flush, std::vector<char>& out) {
+        int ret;
+        do {
+            const std::size_t pos = out.size();
+            out.resize(pos + kOutputChunkSize);
+            stream_.next_out  = reinterpret_cast<Bytef*>(out.data() + pos);
+            stream_.avail_out = kOutputChunkSize;
+
+            ret = deflate(&stream_, flush);
+            if (ret == Z_STREAM_ERROR) {
+                std::cerr << "gzip compression failed" << std::endl;
+                std::exit(1);
+            }
+            out.resize(pos + kOutputChunkSize - stream_.avail_out);
+        } while (flush == Z_FINISH ? ret != Z_STREAM_END : stream_.avail_out == 0);
+    }
+
+    z_stream stream_{};
+};
+#endif // KAGEN_ZLIB_FOUND
+
+#ifdef KAGEN_ZSTD_FOUND
+constexpr int kZstdLevel = 3;
+
+class ZstdCompressor : public Compressor {
+public:
+    ZstdCompressor() : context_(ZSTD_createCCtx()) {
+        if (context_ == nullptr) {
+            std::cerr << "cannot initialize zstd compression" << std::endl;
+            std::exit(1);
+        }
+        ZSTD_CCtx_setParameter(context_, ZSTD_c_compressionLevel, kZstdLevel);
+    }
+
+    ZstdCompressor(const ZstdCompressor&)            = delete;
+    ZstdCompressor& operator=(const ZstdCompressor&) = delete;
+
+    ~ZstdCompressor() override {
+        ZSTD_freeCCtx(context_);
+    }
+
+    void Compress(const char* data, const std::size_t size, std::vector<char>& out) override {
+        ZSTD_inBuffer input{data, size, 0};
+        CompressStream(input, ZSTD_e_continue, out);
+    }
+
+    void Finish(std::vector<char>& out) override {
+        ZSTD_inBuffer input{nullptr, 0, 0};
+        CompressStream(input, ZSTD_e_end, out);
+    }
+
+private:
+    void CompressStream(ZSTD_inBuffer& input, const ZSTD_EndDirective mode, std::vector<char>& out) {
+        std::size_t remaining;
+        do {
+            const std::size_t pos = out.size();
+            out.resize(pos + kOutputChunkSize);
+            ZSTD_outBuffer output{out.data() + pos, kOutputChunkSize, 0};
+
+            remaining = ZSTD_compressStream2(context_, &output, &input, mode);
+            if (ZSTD_isError(remaining)) {
+                std::cerr << "zstd compression failed: " << ZSTD_getErrorName(remaining) << std::endl;
+                std::exit(1);
+            }
+            out.resize(pos + output.pos);
+        } while (mode == ZSTD_e_end ? remaining > 0 : input.pos < input.size);
+    }
+
+    ZSTD_CCtx* context_;
+};
+#endif // KAGEN_ZSTD_FOUND
+} // namespace
+
+bool IsCompressionAvailable(const OutputCompression compression) {
+    switch (compression) {
+        case OutputCompression::NONE:
+            return true;
+
+        case OutputCompression::GZIP:
+#ifdef KAGEN_ZLIB_FOUND
+            return true;
+#else
+            return false;
+#endif // KAGEN_ZLIB_FOUND
+
+        case OutputCompression::ZSTD:
+#ifdef KAGEN_ZSTD_FOUND
+            return true;
+#else
+            return false;
+#endif // KAGEN_ZSTD_FOUND
+    }
+
+    return false;
+}
+
+std::string GetCompressionExtension(const OutputCompression compression) {
+    switch (compression) {
+        case OutputCompression::NONE:
+            return "";
+
+        case OutputCompression::GZIP:
+            return ".gz";
+
+        case OutputCompression::ZSTD:
+            return ".zst";
+    }
+
+    return "";
+}
+
+std::unique_ptr<Compressor> CreateCompressor(const OutputCompression compression) {
+    switch (compression) {
+        case OutputCompression::NONE:
+            return nullptr;
+
+        case OutputCompression::GZIP:
+#ifdef KAGEN_ZLIB_FOUND
+            return std::make_unique<GzipCompressor>();
+#else
+            break;
+#endif // KAGEN_ZLIB_FOUND
+
+        case OutputCompression::ZSTD:
+#ifdef KAGEN_ZSTD_FOUND
+            return std::make_unique<ZstdCompressor>();
+#else
+            break;
+#endif // KAGEN_ZSTD_FOUND
+    }
+
+    std::cerr << "compression " << compression << " is not available: KaGen was built without the required library"
+              << std::endl;
+    std::exit(1);
+}
+} // namespace kagen
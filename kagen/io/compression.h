@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "kagen/context.h"
+
+namespace kagen {
+// Streaming compressor used below BufferedTextOutput. Every compressor produces one self-contained gzip member or zstd
+// frame; since concatenated members / frames form a valid stream, the outputs of several PEs can simply be
+// concatenated.
+class Compressor {
+public:
+    virtual ~Compressor() = default;
+
+    // Compresses `size` bytes of `data` and appends the compressed data produced so far to `out`
+    virtual void Compress(const char* data, std::size_t size, std::vector<char>& out) = 0;
+
+    // Appends the remaining compressed data and ends the member / frame
+    virtual void Finish(std::vector<char>& out) = 0;
+};
+
+// Whether KaGen was built with the library required for the compression
+bool IsCompressionAvailable(OutputCompression compression);
+
+// File extension, including the leading dot, of files compressed with the compression; empty if uncompressed
+std::string GetCompressionExtension(OutputCompression compression);
+
+// Returns nullptr if no compression is requested
+std::unique_ptr<Compressor> CreateCompressor(OutputCompression compression);
+} // namespace kagen
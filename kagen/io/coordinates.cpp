@@ -10,11 +10,9 @@ std::string CoordinatesWriter::DefaultExtension() const {
     return "xyz";
 }
 
-void CoordinatesWriter::AppendHeaderTo(const std::string&, SInt, SInt) {}
-
-void CoordinatesWriter::AppendTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
+void CoordinatesWriter::WriteHeader(BufferedTextOutput<>&, SInt, SInt) {}
 
+void CoordinatesWriter::WriteBody(BufferedTextOutput<>& out) {
     for (const auto& [x, y]: coordinates_.first) {
         out.WriteFloat(x).WriteChar(' ').WriteFloat(y).WriteChar(' ').WriteFloat(0.0).WriteChar('\n').Flush();
     }
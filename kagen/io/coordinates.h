@@ -14,8 +14,8 @@ public:
 protected:
     int Requirements() const final;
 
-    void AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) final;
+    void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) final;
 
-    void AppendTo(const std::string& filename) final;
+    void WriteBody(BufferedTextOutput<>& out) final;
 };
 } // namespace kagen
@@ -15,15 +15,12 @@ int DotWriter::Requirements() const {
     return Requirement::NO_VERTEX_WEIGHTS | Requirement::NO_EDGE_WEIGHTS;
 }
 
-void DotWriter::AppendHeaderTo(const std::string& filename, SInt, SInt) {
-    BufferedTextOutput<> out(tag::append, filename);
-    const char*          type = directed_output_ ? "digraph" : "graph";
+void DotWriter::WriteHeader(BufferedTextOutput<>& out, SInt, SInt) {
+    const char* type = directed_output_ ? "digraph" : "graph";
     out.WriteString(type).WriteString(" G{\n").Flush();
 }
 
-void DotWriter::AppendTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
-
+void DotWriter::WriteBody(BufferedTextOutput<>& out) {
     if (!coordinates_.first.empty()) {
         auto& coordinates = coordinates_.first; // 2D
         for (SInt node = vertex_range_.first; node < vertex_range_.second; ++node) {
@@ -47,8 +44,7 @@ void DotWriter::AppendTo(const std::string& filename) {
     }
 }
 
-void DotWriter::AppendFooterTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
+void DotWriter::WriteFooter(BufferedTextOutput<>& out) {
     out.WriteString("}\n").Flush();
 }
 } // namespace kagen
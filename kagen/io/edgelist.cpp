@@ -4,24 +4,51 @@
 #include "kagen/io/buffered_writer.h"
 #include "kagen/io/graph_writer.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
 namespace kagen {
+namespace {
+// Number of edges that are converted to the output width at once; large enough such that the converted edges bypass
+// the output buffer
+constexpr std::size_t kEdgesPerChunk = 1 << 17;
+
+template <typename UInt>
+void WriteBinaryEdges(const EdgeList& edges, BufferedTextOutput<>& out) {
+    std::vector<UInt> chunk(2 * std::min(kEdgesPerChunk, edges.size()));
+
+    for (std::size_t begin = 0; begin < edges.size(); begin += kEdgesPerChunk) {
+        const std::size_t size = std::min(kEdgesPerChunk, edges.size() - begin);
+        for (std::size_t e = 0; e < size; ++e) {
+            chunk[2 * e]     = static_cast<UInt>(std::get<0>(edges[begin + e]));
+            chunk[2 * e + 1] = static_cast<UInt>(std::get<1>(edges[begin + e]));
+        }
+        out.WriteRaw(chunk.data(), 2 * size * sizeof(UInt));
+    }
+}
+} // namespace
+
 EdgeListWriter::EdgeListWriter(Graph& graph, MPI_Comm comm) : SequentialGraphWriter(graph, comm) {}
 
 std::string EdgeListWriter::DefaultExtension() const {
     return "edgelist";
 }
 
+bool EdgeListWriter::SupportsStreaming() const {
+    return true;
+}
+
 int EdgeListWriter::Requirements() const {
     return Requirement::NO_VERTEX_WEIGHTS | Requirement::NO_EDGE_WEIGHTS;
 }
 
-void EdgeListWriter::AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) {
-    BufferedTextOutput<> out(tag::append, filename);
+void EdgeListWriter::WriteHeader(BufferedTextOutput<>& out, const SInt n, const SInt m) {
     out.WriteString("p ").WriteInt(n).WriteChar(' ').WriteInt(m).WriteChar('\n').Flush();
 }
 
-void EdgeListWriter::AppendTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
+void EdgeListWriter::WriteBody(BufferedTextOutput<>& out) {
     for (const auto& [from, to]: edges_) {
         out.WriteString("e ").WriteInt(from + 1).WriteChar(' ').WriteInt(to + 1).WriteChar('\n').Flush();
     }
@@ -35,29 +62,24 @@ std::string BinaryEdgeListWriter::DefaultExtension() const {
     return "binaryedgelist";
 }
 
+bool BinaryEdgeListWriter::SupportsStreaming() const {
+    return true;
+}
+
 int BinaryEdgeListWriter::Requirements() const {
     return Requirement::NO_VERTEX_WEIGHTS | Requirement::NO_EDGE_WEIGHTS;
 }
 
-void BinaryEdgeListWriter::AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) {
-    auto* fout = std::fopen(filename.c_str(), "ab");
-    std::fwrite(&n, sizeof(SInt), 1, fout);
-    std::fwrite(&m, sizeof(SInt), 1, fout);
-    std::fclose(fout);
+void BinaryEdgeListWriter::WriteHeader(BufferedTextOutput<>& out, const SInt n, const SInt m) {
+    out.WriteRaw(&n, sizeof(SInt)).WriteRaw(&m, sizeof(SInt));
 }
 
-void BinaryEdgeListWriter::AppendTo(const std::string& filename) {
-    auto* fout = std::fopen(filename.c_str(), "ab");
-    for (const auto& [from, to]: edges_) {
-        if (width_ == 64) {
-            const std::uint64_t edges[2] = {static_cast<std::uint64_t>(from), static_cast<std::uint64_t>(to)};
-            std::fwrite(edges, sizeof(std::uint64_t), 2, fout);
-        } else { // 32
-            const std::uint32_t edges[2] = {static_cast<std::uint32_t>(from), static_cast<std::uint32_t>(to)};
-            std::fwrite(edges, sizeof(std::uint32_t), 2, fout);
-        }
+void BinaryEdgeListWriter::WriteBody(BufferedTextOutput<>& out) {
+    if (width_ == 64) {
+        WriteBinaryEdges<std::uint64_t>(edges_, out);
+    } else { // 32
+        WriteBinaryEdges<std::uint32_t>(edges_, out);
     }
-    fclose(fout);
 }
 
 } // namespace kagen
@@ -12,12 +12,14 @@ public:
 
     std::string DefaultExtension() const final;
 
+    bool SupportsStreaming() const final;
+
 protected:
     int Requirements() const final;
 
-    void AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) final;
+    void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) final;
 
-    void AppendTo(const std::string& filename) final;
+    void WriteBody(BufferedTextOutput<>& out) final;
 };
 
 class BinaryEdgeListWriter : public SequentialGraphWriter {
@@ -26,12 +28,14 @@ public:
 
     std::string DefaultExtension() const final;
 
+    bool SupportsStreaming() const final;
+
 protected:
     int Requirements() const final;
 
-    void AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) final;
+    void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) final;
 
-    void AppendTo(const std::string& filename) final;
+    void WriteBody(BufferedTextOutput<>& out) final;
 
 private:
     int width_;
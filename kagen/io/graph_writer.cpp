@@ -2,10 +2,16 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <utility>
 
 #include "kagen/context.h"
+#include "kagen/io/compression.h"
 #include "kagen/io/graph_writer.h"
+#include "kagen/io/manifest.h"
+#include "kagen/tools/radix_sort.h"
 #include "kagen/tools/statistics.h"
+#include "kagen/tools/zip_iterator.h"
 
 namespace kagen {
 GraphWriter::GraphWriter(Graph& graph, MPI_Comm comm)
@@ -31,17 +37,66 @@ bool GraphWriter::HasEdgeWeights() const {
     return has_edge_weights_;
 }
 
+bool GraphWriter::SupportsStreaming() const {
+    return false;
+}
+
+void GraphWriter::WriteStream(const PGeneratorConfig& config, const EdgeStream&) {
+    int rank;
+    MPI_Comm_rank(comm_, &rank);
+    if (rank == ROOT) {
+        std::cerr << "Output format " << config.output_format << " cannot be written while generating the graph\n";
+    }
+    MPI_Abort(comm_, 1);
+}
+
+namespace {
+// Marks the size of the local body as not yet known, see SequentialGraphWriter::WriteFiles()
+constexpr SInt kUnknownNumberOfBytes = std::numeric_limits<SInt>::max();
+
+// Extends `tail_range` such that it contains the tails of all `edges`; an empty range contains no tails yet
+void ExtendTailRange(VertexRange& tail_range, const EdgeList& edges) {
+    if (edges.empty()) {
+        return;
+    }
+
+    const auto [min_it, max_it] = std::minmax_element(edges.begin(), edges.end(), [](const auto& lhs, const auto& rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    });
+    const SInt min_tail = std::get<0>(*min_it);
+    const SInt max_tail = std::get<0>(*max_it);
+
+    if (tail_range.first == tail_range.second) {
+        tail_range = {min_tail, max_tail + 1};
+    } else {
+        tail_range = {std::min(tail_range.first, min_tail), std::max(tail_range.second, max_tail + 1)};
+    }
+}
+
+// Returns the offset at which this PE writes its `num_local_bytes` to a file shared by all PEs of `comm`, and the
+// total number of bytes written by all PEs
+std::pair<SInt, SInt> ComputeFileOffset(SInt num_local_bytes, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    SInt offset           = 0;
+    SInt num_global_bytes = 0;
+    MPI_Exscan(&num_local_bytes, &offset, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    MPI_Allreduce(&num_local_bytes, &num_global_bytes, 1, KAGEN_MPI_SINT, MPI_SUM, comm);
+    if (rank == ROOT) {
+        offset = 0;
+    }
+    return {offset, num_global_bytes};
+}
+} // namespace
+
 SequentialGraphWriter::SequentialGraphWriter(Graph& graph, MPI_Comm comm) : GraphWriter(graph, comm) {}
 
 void SequentialGraphWriter::Write(const PGeneratorConfig& config) {
-    PEID rank, size;
+    PEID rank;
     MPI_Comm_rank(comm_, &rank);
-    MPI_Comm_size(comm_, &size);
     const bool output = !config.quiet && rank == ROOT;
 
-    const std::string base_filename = config.output_file + "." + DefaultExtension();
-    const std::string filename = config.output_single_file ? base_filename : base_filename + "." + std::to_string(rank);
-
     const bool requires_sorted_edges      = Requirements() & Requirement::SORTED_EDGES;
     const bool requires_coordinates       = Requirements() & Requirement::COORDINATES;
     const bool requires_coordinates2d     = Requirements() & Requirement::COORDINATES_2D;
@@ -54,7 +109,11 @@ void SequentialGraphWriter::Write(const PGeneratorConfig& config) {
     // Check if edges have to be sorted
     if (requires_sorted_edges) {
         if (!std::is_sorted(edges_.begin(), edges_.end())) {
-            std::sort(edges_.begin(), edges_.end());
+            if (has_edge_weights_) {
+                ZipSort(edges_, edge_weights_);
+            } else {
+                RadixSortEdges(edges_, config.num_threads);
+            }
         }
     }
 
@@ -85,65 +144,250 @@ void SequentialGraphWriter::Write(const PGeneratorConfig& config) {
             << std::endl;
     }
 
+    EnsureCompressionAvailable(config);
+
     // Everything OK, write graph
-    CreateFile(filename);
+    const IncrementalChecksum file_checksum =
+        WriteFiles(config, edges_.size(), [&](BufferedTextOutput<>& out) { WriteBody(out); }, kUnknownNumberOfBytes);
+
+    if (!config.output_single_file) {
+        VertexRange tail_range{};
+        ExtendTailRange(tail_range, edges_);
+        WriteManifest(config, file_checksum, tail_range, edges_.size());
+    }
+}
+
+// Writes each batch of edges by temporarily moving it into the edge list of the writer
+class SequentialGraphWriter::BodySink : public EdgeSink {
+public:
+    BodySink(SequentialGraphWriter& writer, BufferedTextOutput<>* out) : writer_(writer), out_(out) {}
+
+    void Consume(EdgeList& edges) final {
+        num_edges_ += edges.size();
+        ExtendTailRange(tail_range_, edges);
+        if (out_ != nullptr) {
+            std::swap(writer_.edges_, edges);
+            writer_.WriteBody(*out_);
+            std::swap(writer_.edges_, edges);
+        }
+    }
+
+    void Finish(const VertexRange vertex_range) final {
+        writer_.vertex_range_ = vertex_range;
+    }
+
+    SInt GetNumberOfEdges() const {
+        return num_edges_;
+    }
+
+    VertexRange GetTailRange() const {
+        return tail_range_;
+    }
+
+private:
+    SequentialGraphWriter& writer_;
+    BufferedTextOutput<>*  out_;
+    SInt                   num_edges_  = 0;
+    VertexRange            tail_range_ = {0, 0};
+};
+
+void SequentialGraphWriter::WriteStream(const PGeneratorConfig& config, const EdgeStream& generate) {
+    PEID size;
+    MPI_Comm_size(comm_, &size);
+
+    EnsureCompressionAvailable(config);
+
+    const bool requires_header  = config.output_header != OutputHeader::NEVER;
+    const bool requires_offsets = config.output_single_file && size > 1
+                                  && config.output_compression == OutputCompression::NONE;
+
+    // First pass: count the local edges and, if the PEs write to the same file concurrently, the size of the body
+    SInt num_local_edges = 0;
+    SInt num_body_bytes  = kUnknownNumberOfBytes;
+    if (requires_header || requires_offsets) {
+        BufferedTextOutput<> out(tag::count);
+        BodySink             sink(*this, requires_offsets ? &out : nullptr);
+        generate(sink);
+
+        num_local_edges = sink.GetNumberOfEdges();
+        if (requires_offsets) {
+            num_body_bytes = out.GetNumberOfBytes();
+        }
+    }
+
+    // Second pass: write the edges
+    SInt        num_written_edges = 0;
+    VertexRange tail_range        = {0, 0};
+    auto        write_body        = [&](BufferedTextOutput<>& out) {
+        BodySink sink(*this, &out);
+        generate(sink);
+        num_written_edges = sink.GetNumberOfEdges();
+        tail_range        = sink.GetTailRange();
+    };
+    const IncrementalChecksum file_checksum = WriteFiles(config, num_local_edges, write_body, num_body_bytes);
+
+    if (!config.output_single_file) {
+        WriteManifest(config, file_checksum, tail_range, num_written_edges);
+    }
+}
+
+IncrementalChecksum SequentialGraphWriter::WriteFiles(
+    const PGeneratorConfig& config, const SInt num_local_edges, const BodyWriter& write_body,
+    const SInt num_body_bytes) {
+    IncrementalChecksum file_checksum;
+
+    PEID rank, size;
+    MPI_Comm_rank(comm_, &rank);
+    MPI_Comm_size(comm_, &size);
+    const bool output = !config.quiet && rank == ROOT;
+
+    const OutputCompression compression           = config.output_compression;
+    const std::string       compression_extension = GetCompressionExtension(compression);
+
+    const std::string base_filename = GetBaseFilename(config);
+    const std::string rank_suffix   = config.output_single_file ? "" : "." + std::to_string(rank);
+    const std::string filename      = base_filename + rank_suffix + compression_extension;
+
+    if (!config.output_single_file || rank == ROOT) {
+        CreateFile(filename);
+    }
 
     if (config.output_single_file) {
         const SInt n = FindNumberOfGlobalNodes(vertex_range_, comm_);
-        const SInt m = FindNumberOfGlobalEdges(edges_, comm_);
+        SInt       m;
+        MPI_Allreduce(&num_local_edges, &m, 1, KAGEN_MPI_SINT, MPI_SUM, comm_);
 
         if (output) {
             std::cout << "Writing graph to " << filename << " in " << config.output_format << " format" << std::endl;
         }
 
-        if (rank == ROOT && config.output_header != OutputHeader::NEVER) {
-            AppendHeaderTo(filename, n, m);
-        }
+        const bool write_header_footer = config.output_header != OutputHeader::NEVER;
 
-        for (PEID pe = 0; pe < size; ++pe) {
-            if (output) {
-                std::cout << "  Writing subgraph of PE " << pe << " ... " << std::flush;
+        if (size == 1) { // No need to format the graph twice
+            BufferedTextOutput<> out(tag::append, filename, CreateCompressor(compression));
+            if (write_header_footer) {
+                WriteHeader(out, n, m);
             }
-            if (rank == pe) {
-                AppendTo(filename);
+            write_body(out);
+            if (write_header_footer) {
+                WriteFooter(out);
             }
-            if (output) {
-                std::cout << "done" << std::endl;
+        } else if (compression != OutputCompression::NONE) {
+            // The size of a compressed part is only known once it has been compressed: all PEs compress their parts
+            // into memory concurrently, each one as an independent gzip member / zstd frame, then write them at their
+            // position in the file
+            std::vector<char> compressed;
+            {
+                BufferedTextOutput<> out(tag::memory, compressed, CreateCompressor(compression));
+                if (rank == ROOT && write_header_footer) {
+                    WriteHeader(out, n, m);
+                }
+                write_body(out);
+            }
+
+            const auto [offset, num_global_bytes] = ComputeFileOffset(compressed.size(), comm_);
+            {
+                BufferedTextOutput<> out(tag::write_at, filename, offset);
+                out.WriteRaw(compressed.data(), compressed.size());
+            }
+            if (rank == ROOT && write_header_footer) {
+                std::vector<char> footer;
+                {
+                    BufferedTextOutput<> out(tag::memory, footer, CreateCompressor(compression));
+                    WriteFooter(out);
+                }
+                BufferedTextOutput<> out(tag::write_at, filename, num_global_bytes);
+                out.WriteRaw(footer.data(), footer.size());
             }
             MPI_Barrier(comm_);
-        }
+        } else {
+            // Format everything once to find the position of each part in the file, then write all parts concurrently
+            auto write_header_and_body = [&](BufferedTextOutput<>& out) {
+                if (rank == ROOT && write_header_footer) {
+                    WriteHeader(out, n, m);
+                }
+                write_body(out);
+            };
 
-        if (rank == ROOT && config.output_header != OutputHeader::NEVER) {
-            AppendFooterTo(filename);
+            SInt num_local_bytes = num_body_bytes;
+            if (num_local_bytes == kUnknownNumberOfBytes) {
+                BufferedTextOutput<> out(tag::count);
+                write_body(out);
+                num_local_bytes = out.GetNumberOfBytes();
+            }
+            if (rank == ROOT && write_header_footer) {
+                BufferedTextOutput<> out(tag::count);
+                WriteHeader(out, n, m);
+                num_local_bytes += out.GetNumberOfBytes();
+            }
+
+            const auto [offset, num_global_bytes] = ComputeFileOffset(num_local_bytes, comm_);
+
+            // The root PE created the file before contributing to the reductions, thus it exists at this point
+            {
+                BufferedTextOutput<> out(tag::write_at, filename, offset);
+                write_header_and_body(out);
+            }
+            if (rank == ROOT && write_header_footer) {
+                BufferedTextOutput<> out(tag::write_at, filename, num_global_bytes);
+                WriteFooter(out);
+            }
+            MPI_Barrier(comm_);
         }
     } else {
         const SInt n                   = vertex_range_.second - vertex_range_.first;
-        const SInt m                   = edges_.size();
+        const SInt m                   = num_local_edges;
         const bool write_header_footer = (rank == ROOT && config.output_header == OutputHeader::ROOT)
                                          || config.output_header == OutputHeader::ALWAYS;
 
         if (output) {
-            std::cout << "Writing graph to [" << base_filename << ".0";
+            std::cout << "Writing graph to [" << base_filename << ".0" << compression_extension;
             if (size > 2) {
                 std::cout << ", ...";
             }
             if (size > 1) {
-                std::cout << ", " << base_filename << "." << size - 1;
+                std::cout << ", " << base_filename << "." << size - 1 << compression_extension;
             }
             std::cout << "] in " << config.output_format << " format" << std::endl;
         }
 
+        BufferedTextOutput<> out(tag::append, filename, CreateCompressor(compression), &file_checksum);
         if (write_header_footer) {
-            AppendHeaderTo(filename, n, m);
+            WriteHeader(out, n, m);
         }
-        AppendTo(filename);
+        write_body(out);
         if (write_header_footer) {
-            AppendFooterTo(filename);
+            WriteFooter(out);
         }
     }
+
+    return file_checksum;
 }
 
-void SequentialGraphWriter::AppendFooterTo(const std::string&) {}
+void SequentialGraphWriter::WriteManifest(
+    const PGeneratorConfig& config, const IncrementalChecksum& file_checksum, const VertexRange tail_range,
+    const SInt num_local_edges) {
+    kagen::WriteManifest(
+        config, GetBaseFilename(config), file_checksum, vertex_range_, tail_range, num_local_edges, comm_);
+}
+
+std::string SequentialGraphWriter::GetBaseFilename(const PGeneratorConfig& config) const {
+    return config.output_file + "." + DefaultExtension();
+}
+
+void SequentialGraphWriter::EnsureCompressionAvailable(const PGeneratorConfig& config) const {
+    if (!IsCompressionAvailable(config.output_compression)) {
+        int rank;
+        MPI_Comm_rank(comm_, &rank);
+        if (rank == ROOT) {
+            std::cerr << "Output compression " << config.output_compression
+                      << " is not available: KaGen was built without the required library\n";
+        }
+        std::exit(1);
+    }
+}
+
+void SequentialGraphWriter::WriteFooter(BufferedTextOutput<>&) {}
 
 int SequentialGraphWriter::Requirements() const {
     return Requirement::NONE;
@@ -160,4 +404,13 @@ std::string NoopWriter::DefaultExtension() const {
 }
 
 void NoopWriter::Write(const PGeneratorConfig&) {}
+
+bool NoopWriter::SupportsStreaming() const {
+    return true;
+}
+
+void NoopWriter::WriteStream(const PGeneratorConfig&, const EdgeStream& generate) {
+    CallbackEdgeSink discard([](const EdgeList&) {});
+    generate(discard);
+}
 } // namespace kagen
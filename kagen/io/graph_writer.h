@@ -1,15 +1,24 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include <mpi.h>
 
 #include "kagen/context.h"
 #include "kagen/definitions.h"
+#include "kagen/generators/generator.h"
+#include "kagen/io/buffered_writer.h"
+#include "kagen/io/checksum.h"
 
 namespace kagen {
 class GraphWriter {
 public:
+    // Passes the local edges to the given sink in batches; must pass the same edges on every call. Every PE calls it
+    // equally often, but at different times, thus it may only communicate collectively on the communicator of the
+    // writer.
+    using EdgeStream = std::function<void(EdgeSink&)>;
+
     GraphWriter(Graph& graph, MPI_Comm comm);
 
     virtual ~GraphWriter();
@@ -18,6 +27,15 @@ public:
 
     virtual void Write(const PGeneratorConfig& config) = 0;
 
+    // Whether the output only depends on the edges in the order in which they were generated, i.e., whether the
+    // graph can be written by WriteStream().
+    virtual bool SupportsStreaming() const;
+
+    // Writes the edges passed by `generate` while they are generated, without keeping more than one batch of edges in
+    // memory. The graph passed to the constructor must be empty and is used to hold the current batch. Must only be
+    // called if SupportsStreaming(); the default implementation aborts.
+    virtual void WriteStream(const PGeneratorConfig& config, const EdgeStream& generate);
+
 protected:
     bool HasVertexWeights() const;
     bool HasEdgeWeights() const;
@@ -48,18 +66,45 @@ protected:
 public:
     SequentialGraphWriter(Graph& graph, MPI_Comm comm);
 
+    // With distributed output, each PE writes its own file and the root PE additionally writes a manifest describing
+    // all files, see kagen/io/manifest.h.
     virtual void Write(const PGeneratorConfig& config) override;
 
+    // Runs `generate` once to count the local edges if the file header or the position of the local part in the file
+    // depend on it, and once more to write the edges.
+    virtual void WriteStream(const PGeneratorConfig& config, const EdgeStream& generate) override;
+
 protected:
-    virtual void AppendHeaderTo(const std::string& filename, SInt n, SInt m) = 0;
+    // When writing to a single file, the header and footer are written by the root PE; the bodies of all PEs are
+    // written concurrently, thus they must not depend on each other.
+    virtual void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) = 0;
 
-    virtual void AppendTo(const std::string& filename) = 0;
+    virtual void WriteBody(BufferedTextOutput<>& out) = 0;
 
-    virtual void AppendFooterTo(const std::string& filename);
+    virtual void WriteFooter(BufferedTextOutput<>& out);
 
     virtual int Requirements() const;
 
 private:
+    class BodySink;
+
+    using BodyWriter = std::function<void(BufferedTextOutput<>&)>;
+
+    // Creates the output file(s) and writes the header, the local body and the footer. `write_body` is called twice
+    // when writing a single uncompressed file with multiple PEs, unless the size of the local body is already known.
+    // With distributed output, returns the size and checksum of the local file.
+    IncrementalChecksum WriteFiles(
+        const PGeneratorConfig& config, SInt num_local_edges, const BodyWriter& write_body, SInt num_body_bytes);
+
+    // Writes the manifest of a distributed output after each PE wrote its file, see kagen/io/manifest.h
+    void WriteManifest(
+        const PGeneratorConfig& config, const IncrementalChecksum& file_checksum, VertexRange tail_range,
+        SInt num_local_edges);
+
+    std::string GetBaseFilename(const PGeneratorConfig& config) const;
+
+    void EnsureCompressionAvailable(const PGeneratorConfig& config) const;
+
     static void CreateFile(const std::string& filename);
 };
 
@@ -70,5 +115,9 @@ public:
     std::string DefaultExtension() const final;
 
     void Write(const PGeneratorConfig& config) final;
+
+    bool SupportsStreaming() const final;
+
+    void WriteStream(const PGeneratorConfig& config, const EdgeStream& generate) final;
 };
 } // namespace kagen
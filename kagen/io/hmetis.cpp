@@ -9,8 +9,7 @@ std::string HMetisWriter::DefaultExtension() const {
     return "hgr";
 }
 
-void HMetisWriter::AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) {
-    BufferedTextOutput<> out(tag::append, filename);
+void HMetisWriter::WriteHeader(BufferedTextOutput<>& out, const SInt n, const SInt m) {
     out.WriteInt(m / 2).WriteChar(' ').WriteInt(n);
     if (HasVertexWeights() || HasEdgeWeights()) {
         out.WriteChar(' ');
@@ -26,9 +25,7 @@ void HMetisWriter::AppendHeaderTo(const std::string& filename, const SInt n, con
     out.WriteChar('\n').Flush();
 }
 
-void HMetisWriter::AppendTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
-
+void HMetisWriter::WriteBody(BufferedTextOutput<>& out) {
     for (SInt e = 0; e < edges_.size(); ++e) {
         const auto& [from, to] = edges_[e];
 
@@ -43,12 +40,11 @@ void HMetisWriter::AppendTo(const std::string& filename) {
     }
 }
 
-void HMetisWriter::AppendFooterTo(const std::string& filename) {
+void HMetisWriter::WriteFooter(BufferedTextOutput<>& out) {
     if (!HasVertexWeights()) {
         return;
     }
 
-    BufferedTextOutput<> out(tag::append, filename);
     for (const SSInt& weight: vertex_weights_) {
         out.WriteInt(weight).WriteChar('\n').Flush();
     }
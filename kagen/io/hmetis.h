@@ -12,10 +12,10 @@ public:
     std::string DefaultExtension() const final;
 
 protected:
-    void AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) final;
+    void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) final;
 
-    void AppendTo(const std::string& filename) final;
+    void WriteBody(BufferedTextOutput<>& out) final;
 
-    void AppendFooterTo(const std::string &filename) final;
+    void WriteFooter(BufferedTextOutput<>& out) final;
 };
 } // namespace kagen
@@ -2,12 +2,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iomanip>
+#include <iostream>
 #include <memory>
 
 #include <mpi.h>
 
 #include "kagen/context.h"
 #include "kagen/definitions.h"
+#include "kagen/facade.h"
 #include "kagen/io/binary_parhip.h"
 #include "kagen/io/buffered_writer.h"
 #include "kagen/io/coordinates.h"
@@ -15,11 +18,16 @@
 #include "kagen/io/edgelist.h"
 #include "kagen/io/graph_writer.h"
 #include "kagen/io/hmetis.h"
+#include "kagen/io/kagen_binary.h"
 #include "kagen/io/metis.h"
 #include "kagen/tools/statistics.h"
 
 namespace kagen {
 namespace {
+// Number of edges generated between two writes when streaming the graph to disk, i.e., the number of edges kept in
+// memory at once
+constexpr SInt kStreamBufferSize = 1 << 20;
+
 std::unique_ptr<GraphWriter> CreateGraphWriter(const OutputFormat format, Graph& graph, MPI_Comm comm) {
     switch (format) {
         case OutputFormat::NONE:
@@ -51,6 +59,9 @@ std::unique_ptr<GraphWriter> CreateGraphWriter(const OutputFormat format, Graph&
 
         case OutputFormat::BINARY_PARHIP:
             return std::make_unique<BinaryParHipWriter>(graph, comm);
+
+        case OutputFormat::KAGEN:
+            return std::make_unique<KaGenBinaryWriter>(graph, comm);
     }
 
     __builtin_unreachable();
@@ -62,4 +73,53 @@ void WriteGraph(const PGeneratorConfig& config, Graph& graph, MPI_Comm comm) {
     auto writer = CreateGraphWriter(config.output_format, graph, comm);
     writer->Write(config);
 }
+
+void GenerateAndWriteGraph(const PGeneratorConfig& config, MPI_Comm comm) {
+    PEID rank;
+    MPI_Comm_rank(comm, &rank);
+    const bool output_info = rank == ROOT && !config.quiet;
+
+    if (config.stream_output && CreateGeneratorFactory(config.generator)->IsCommunicationFree()) {
+        Graph graph{};
+        graph.representation = GraphRepresentation::EDGE_LIST;
+
+        auto writer = CreateGraphWriter(config.output_format, graph, comm);
+        if (writer->SupportsStreaming()) {
+            PGeneratorConfig generator_config = config;
+            auto             generator        = CreateStreamingGenerator(generator_config, comm);
+            const auto       start            = MPI_Wtime();
+
+            // Edges with vertex IDs that do not fit into VertexID are dropped while generating: abort before the
+            // writer commits the header or footer of an incomplete graph
+            writer->WriteStream(config, [&](EdgeSink& sink) {
+                generator->SetEdgeSink(&sink, kStreamBufferSize);
+                generator->Generate(GraphRepresentation::EDGE_LIST);
+                CheckVertexIDWidth(*generator, comm);
+            });
+            MPI_Barrier(comm);
+
+            const auto end = MPI_Wtime();
+
+            if (!config.quiet) {
+                const SInt num_local_edges = generator->GetNumberOfEdges();
+                SInt       num_global_edges;
+                MPI_Reduce(&num_local_edges, &num_global_edges, 1, KAGEN_MPI_SINT, MPI_SUM, ROOT, comm);
+
+                if (output_info) {
+                    std::cout << "Generated and wrote " << num_global_edges << " edges in " << std::fixed
+                              << std::setprecision(3) << end - start << " seconds" << std::endl;
+                }
+            }
+            return;
+        }
+    }
+
+    Graph graph = Generate(config, GraphRepresentation::EDGE_LIST, comm);
+    if (config.stream_output && output_info) {
+        std::cout << "Note: the graph was not written while generating it, since the generator requires postprocessing "
+                     "or the output format requires the whole graph"
+                  << std::endl;
+    }
+    WriteGraph(config, graph, comm);
+}
 } // namespace kagen
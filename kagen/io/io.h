@@ -9,4 +9,9 @@
 
 namespace kagen {
 void WriteGraph(const PGeneratorConfig& config, Graph& graph, MPI_Comm comm);
+
+// Generates the graph and writes it to disk. If config.stream_output is set, the generator is communication-free and
+// the output format supports it, edges are written while they are generated and never kept in memory all at once;
+// otherwise, this is the same as calling Generate() followed by WriteGraph().
+void GenerateAndWriteGraph(const PGeneratorConfig& config, MPI_Comm comm);
 } // namespace kagen
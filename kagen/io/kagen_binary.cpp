@@ -0,0 +1,176 @@
+#include "kagen/io/kagen_binary.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kagen/io/graph_writer.h"
+#include "kagen/io/mpi_io.h"
+#include "kagen/tools/radix_sort.h"
+#include "kagen/tools/statistics.h"
+#include "kagen/tools/zip_iterator.h"
+
+namespace kagen {
+namespace {
+std::uint64_t Align(const std::uint64_t pos) {
+    return (pos + kKaGenBinaryAlignment - 1) / kKaGenBinaryAlignment * kKaGenBinaryAlignment;
+}
+
+// Number of bytes required to store all weights of all PEs
+std::uint8_t FindWeightWidth(const std::vector<SSInt>& weights, MPI_Comm comm) {
+    bool fits_int32 = std::all_of(weights.begin(), weights.end(), [](const SSInt weight) {
+        return weight >= std::numeric_limits<std::int32_t>::min() && weight <= std::numeric_limits<std::int32_t>::max();
+    });
+    MPI_Allreduce(MPI_IN_PLACE, &fits_int32, 1, MPI_CXX_BOOL, MPI_LAND, comm);
+    return fits_int32 ? 4 : 8;
+}
+
+// Writes `data` with `width` bytes per element: either as it is or after converting it to a narrower type
+template <typename Narrow, typename T>
+void WriteAtAllWithWidth(
+    MPI_File file, const MPI_Offset pos, const std::vector<T>& data, const std::uint8_t width, MPI_Comm comm) {
+    if (width == sizeof(T)) {
+        WriteAtAll(file, pos, data, comm);
+    } else {
+        WriteAtAll(file, pos, std::vector<Narrow>(data.begin(), data.end()), comm);
+    }
+}
+} // namespace
+
+KaGenBinaryWriter::KaGenBinaryWriter(Graph& graph, MPI_Comm comm) : GraphWriter(graph, comm) {}
+
+std::string KaGenBinaryWriter::DefaultExtension() const {
+    return "kagen";
+}
+
+void KaGenBinaryWriter::Write(const PGeneratorConfig& config) {
+    PEID rank = 0, size = 0;
+    MPI_Comm_rank(comm_, &rank);
+    MPI_Comm_size(comm_, &size);
+
+    const bool        output   = !config.quiet && rank == ROOT;
+    const std::string filename = config.output_file + "." + DefaultExtension();
+
+    if (!config.output_single_file && output) {
+        std::cout
+            << "Warning: this file format does not support distributed output; writing the graph to a single file."
+            << std::endl;
+    }
+    if (config.output_compression != OutputCompression::NONE && output) {
+        std::cout << "Warning: this file format does not support compression; writing the graph uncompressed."
+                  << std::endl;
+    }
+
+    // Edges must be sorted in order to convert them to the CSR format
+    if (!std::is_sorted(edges_.begin(), edges_.end())) {
+        if (HasEdgeWeights()) {
+            ZipSort(edges_, edge_weights_);
+        } else {
+            RadixSortEdges(edges_, config.num_threads);
+        }
+    }
+
+    const SInt num_global_vertices = FindNumberOfGlobalNodes(vertex_range_, comm_);
+    const SInt num_global_edges    = FindNumberOfGlobalEdges(edges_, comm_);
+
+    const SInt num_local_vertices = vertex_range_.second - vertex_range_.first;
+    const SInt num_local_edges    = edges_.size();
+    SInt       first_local_edge   = 0;
+    MPI_Exscan(&num_local_edges, &first_local_edge, 1, KAGEN_MPI_SINT, MPI_SUM, comm_);
+    if (rank == ROOT) {
+        first_local_edge = 0;
+    }
+
+    // Header and section table
+    KaGenBinaryHeader header{};
+    std::memcpy(header.magic, kKaGenBinaryMagic, sizeof(header.magic));
+    header.version             = kKaGenBinaryVersion;
+    header.id_width            = num_global_vertices <= (1ull << 32) ? 4 : 8;
+    header.offset_width        = num_global_edges < (1ull << 32) ? 4 : 8;
+    header.vertex_weight_width = HasVertexWeights() ? FindWeightWidth(vertex_weights_, comm_) : 0;
+    header.edge_weight_width   = HasEdgeWeights() ? FindWeightWidth(edge_weights_, comm_) : 0;
+    header.num_vertices        = num_global_vertices;
+    header.num_edges           = num_global_edges;
+    header.num_sections        = static_cast<std::uint64_t>(size);
+
+    header.xadj_pos   = Align(sizeof(KaGenBinaryHeader) + size * sizeof(KaGenBinarySection));
+    header.adjncy_pos = Align(header.xadj_pos + (num_global_vertices + 1) * header.offset_width);
+    std::uint64_t end = header.adjncy_pos + num_global_edges * header.id_width;
+    if (HasVertexWeights()) {
+        header.vertex_weights_pos = Align(end);
+        end                       = header.vertex_weights_pos + num_global_vertices * header.vertex_weight_width;
+    }
+    if (HasEdgeWeights()) {
+        header.edge_weights_pos = Align(end);
+    }
+
+    const KaGenBinarySection local_section = {
+        vertex_range_.first, num_local_vertices, first_local_edge, num_local_edges};
+    std::vector<KaGenBinarySection> sections(size);
+    MPI_Allgather(
+        &local_section, sizeof(KaGenBinarySection), MPI_BYTE, sections.data(), sizeof(KaGenBinarySection), MPI_BYTE,
+        comm_);
+
+    // Generate the CSR data; the last PE also writes the offset one past the last vertex
+    std::vector<SInt>     xadj(num_local_vertices + (rank + 1 == size));
+    std::vector<VertexID> adjncy(num_local_edges);
+
+    SInt cur_edge = 0;
+    for (SInt u = 0; u < num_local_vertices; ++u) {
+        xadj[u] = first_local_edge + cur_edge;
+        while (cur_edge < num_local_edges && std::get<0>(edges_[cur_edge]) == vertex_range_.first + u) {
+            adjncy[cur_edge] = std::get<1>(edges_[cur_edge]);
+            ++cur_edge;
+        }
+    }
+    if (rank + 1 == size) {
+        xadj.back() = first_local_edge + cur_edge;
+    }
+
+    // Write graph to binary file: all PEs write concurrently
+    MPI_File file;
+    if (MPI_File_open(comm_, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file)
+        != MPI_SUCCESS) {
+        if (rank == ROOT) {
+            std::cerr << "Error: cannot write to " << filename << "\n";
+        }
+        std::exit(1);
+    }
+    MPI_File_set_size(file, 0);
+
+    std::vector<KaGenBinaryHeader> header_part;
+    if (rank == ROOT) {
+        header_part.push_back(header);
+    } else {
+        sections.clear();
+    }
+    WriteAtAll(file, 0, header_part, comm_);
+    WriteAtAll(file, sizeof(KaGenBinaryHeader), sections, comm_);
+
+    WriteAtAllWithWidth<std::uint32_t>(
+        file, header.xadj_pos + vertex_range_.first * header.offset_width, xadj, header.offset_width, comm_);
+    { [[maybe_unused]] auto _clear = std::move(xadj); }
+    WriteAtAllWithWidth<std::uint32_t>(
+        file, header.adjncy_pos + first_local_edge * header.id_width, adjncy, header.id_width, comm_);
+    { [[maybe_unused]] auto _clear = std::move(adjncy); }
+
+    if (HasVertexWeights()) {
+        WriteAtAllWithWidth<std::int32_t>(
+            file, header.vertex_weights_pos + vertex_range_.first * header.vertex_weight_width, vertex_weights_,
+            header.vertex_weight_width, comm_);
+    }
+    if (HasEdgeWeights()) {
+        WriteAtAllWithWidth<std::int32_t>(
+            file, header.edge_weights_pos + first_local_edge * header.edge_weight_width, edge_weights_,
+            header.edge_weight_width, comm_);
+    }
+
+    MPI_File_close(&file);
+}
+} // namespace kagen
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <mpi.h>
+
+#include "kagen/io/graph_writer.h"
+
+namespace kagen {
+// KaGen's native binary CSR format. All values are stored in the byte order of the machine that wrote the file:
+//
+// - KaGenBinaryHeader
+// - Section table: one KaGenBinarySection for each PE that wrote the file
+// - xadj: num_vertices + 1 global edge offsets of `offset_width` bytes each
+// - adjncy: num_edges vertex IDs of `id_width` bytes each
+// - Vertex weights (if vertex_weight_width > 0): num_vertices signed integers of `vertex_weight_width` bytes each
+// - Edge weights (if edge_weight_width > 0): num_edges signed integers of `edge_weight_width` bytes each
+//
+// Each array starts at the byte position stored in the header, which is a multiple of kKaGenBinaryAlignment. Thus, the
+// arrays can be used directly from a memory mapping of the file. Widths are 4 bytes whenever all values fit.
+constexpr char          kKaGenBinaryMagic[8]  = {'K', 'A', 'G', 'E', 'N', 'C', 'S', 'R'};
+constexpr std::uint32_t kKaGenBinaryVersion   = 1;
+constexpr std::uint64_t kKaGenBinaryAlignment = 64;
+
+struct KaGenBinaryHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint8_t  id_width;
+    std::uint8_t  offset_width;
+    std::uint8_t  vertex_weight_width;
+    std::uint8_t  edge_weight_width;
+    std::uint64_t num_vertices;
+    std::uint64_t num_edges;
+    std::uint64_t num_sections;
+    std::uint64_t xadj_pos;
+    std::uint64_t adjncy_pos;
+    std::uint64_t vertex_weights_pos;
+    std::uint64_t edge_weights_pos;
+};
+
+// Part of the graph written by one PE
+struct KaGenBinarySection {
+    std::uint64_t first_vertex;
+    std::uint64_t num_vertices;
+    std::uint64_t first_edge;
+    std::uint64_t num_edges;
+};
+
+class KaGenBinaryWriter : public GraphWriter {
+public:
+    KaGenBinaryWriter(Graph& graph, MPI_Comm comm);
+
+    std::string DefaultExtension() const final;
+
+    void Write(const PGeneratorConfig& config) final;
+};
+} // namespace kagen
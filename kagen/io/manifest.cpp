@@ -0,0 +1,72 @@
+#include "kagen/io/manifest.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+
+namespace kagen {
+namespace {
+void WriteManifestFile(
+    const PGeneratorConfig& config, const std::string& manifest_filename,
+    const std::vector<KaGenManifestEntry>& entries) {
+    KaGenManifestHeader header{};
+    std::memcpy(header.magic, kKaGenManifestMagic, sizeof(header.magic));
+    header.version            = kKaGenManifestVersion;
+    header.output_format      = static_cast<std::uint32_t>(config.output_format);
+    header.output_compression = static_cast<std::uint32_t>(config.output_compression);
+    header.num_files          = entries.size();
+    for (const auto& entry: entries) {
+        header.num_vertices = std::max<std::uint64_t>(header.num_vertices, entry.last_vertex);
+        header.num_edges += entry.num_edges;
+    }
+
+    std::ofstream out(manifest_filename, std::ios_base::binary | std::ios_base::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(KaGenManifestHeader));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(KaGenManifestEntry));
+    if (!out) {
+        std::cerr << "Error: cannot write to " << manifest_filename << "\n";
+        std::exit(1);
+    }
+
+    if (!config.quiet) {
+        std::cout << "Wrote manifest of the distributed output to " << manifest_filename << std::endl;
+    }
+}
+} // namespace
+
+std::string GetManifestFilename(const std::string& base_filename) {
+    return base_filename + ".manifest";
+}
+
+void WriteManifest(
+    const PGeneratorConfig& config, const std::string& base_filename, const IncrementalChecksum& file_checksum,
+    const VertexRange vertex_range, const VertexRange tail_range, const SInt num_edges, MPI_Comm comm) {
+    PEID rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    const std::uint64_t      num_bytes   = file_checksum.GetNumberOfBytes();
+    const std::uint64_t      checksum    = file_checksum.GetChecksum();
+    const KaGenManifestEntry local_entry = {
+        vertex_range.first, vertex_range.second, tail_range.first, tail_range.second, num_edges, num_bytes, checksum};
+    std::vector<KaGenManifestEntry> entries(rank == ROOT ? size : 0);
+    MPI_Gather(
+        &local_entry, sizeof(KaGenManifestEntry), MPI_BYTE, entries.data(), sizeof(KaGenManifestEntry), MPI_BYTE, ROOT,
+        comm);
+
+    if (rank == ROOT) {
+        WriteManifestFile(config, GetManifestFilename(base_filename), entries);
+    }
+
+    // Readers must not see the manifest of a previous output
+    MPI_Barrier(comm);
+}
+} // namespace kagen
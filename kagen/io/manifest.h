@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <mpi.h>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/io/checksum.h"
+
+namespace kagen {
+// Manifest written next to the files of a distributed output, i.e., when each PE writes its own file. It describes the
+// files such that a later job with any number of PEs can load them without scanning them first. All values are stored
+// in the byte order of the machine that wrote the manifest:
+//
+// - KaGenManifestHeader
+// - One KaGenManifestEntry for each file, in the order of the PEs that wrote them
+//
+// The files are named <manifest filename without .manifest>.<rank><compression extension>.
+constexpr char          kKaGenManifestMagic[8] = {'K', 'A', 'G', 'E', 'N', 'M', 'N', 'F'};
+constexpr std::uint32_t kKaGenManifestVersion  = 1;
+
+struct KaGenManifestHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t output_format;      // OutputFormat of the files
+    std::uint32_t output_compression; // OutputCompression of the files
+    std::uint32_t reserved;
+    std::uint64_t num_vertices;
+    std::uint64_t num_edges;
+    std::uint64_t num_files;
+};
+
+struct KaGenManifestEntry {
+    std::uint64_t first_vertex; // Vertex range of the PE that wrote the file
+    std::uint64_t last_vertex;  // (exclusive)
+    std::uint64_t first_tail;   // Range of the tails of all edges in the file, empty if the file contains no edges
+    std::uint64_t last_tail;    // (exclusive)
+    std::uint64_t num_edges;    // Number of edges in the file
+    std::uint64_t num_bytes;    // Size of the file, including its header
+    std::uint64_t checksum;     // See ComputeChecksum()
+};
+
+std::string GetManifestFilename(const std::string& base_filename);
+
+// Collectively writes the manifest of the distributed output with base filename `base_filename`, after each PE wrote
+// its file; `file_checksum` was computed while the file was written. Returns once the manifest has been written.
+void WriteManifest(
+    const PGeneratorConfig& config, const std::string& base_filename, const IncrementalChecksum& file_checksum,
+    VertexRange vertex_range, VertexRange tail_range, SInt num_edges, MPI_Comm comm);
+} // namespace kagen
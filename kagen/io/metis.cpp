@@ -14,8 +14,7 @@ int MetisWriter::Requirements() const {
     return SequentialGraphWriter::Requirement::SORTED_EDGES;
 }
 
-void MetisWriter::AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) {
-    BufferedTextOutput<> out(tag::append, filename);
+void MetisWriter::WriteHeader(BufferedTextOutput<>& out, const SInt n, const SInt m) {
     out.WriteInt(n).WriteChar(' ').WriteInt(m / 2);
 
     const bool has_vertex_weights = HasVertexWeights();
@@ -31,9 +30,7 @@ void MetisWriter::AppendHeaderTo(const std::string& filename, const SInt n, cons
     out.WriteChar('\n').Flush();
 }
 
-void MetisWriter::AppendTo(const std::string& filename) {
-    BufferedTextOutput<> out(tag::append, filename);
-
+void MetisWriter::WriteBody(BufferedTextOutput<>& out) {
     const bool has_vertex_weights = HasVertexWeights();
     const bool has_edge_weights   = HasEdgeWeights();
 
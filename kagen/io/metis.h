@@ -12,9 +12,9 @@ public:
     std::string DefaultExtension() const final;
 
 protected:
-    void AppendHeaderTo(const std::string& filename, const SInt n, const SInt m) final;
+    void WriteHeader(BufferedTextOutput<>& out, SInt n, SInt m) final;
 
-    void AppendTo(const std::string& filename) final;
+    void WriteBody(BufferedTextOutput<>& out) final;
 
     int Requirements() const final;
 };
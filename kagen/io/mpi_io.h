@@ -0,0 +1,29 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <mpi.h>
+
+#include "kagen/definitions.h"
+
+namespace kagen {
+// Collectively writes `data` to `file`, starting at byte `pos`. MPI counts are ints, thus large arrays are written in
+// chunks; PEs that run out of data participate with empty writes.
+template <typename T>
+void WriteAtAll(MPI_File file, MPI_Offset pos, const std::vector<T>& data, MPI_Comm comm) {
+    constexpr SInt kChunkSize = (1 << 30) / sizeof(T);
+
+    const SInt num_local_chunks = (data.size() + kChunkSize - 1) / kChunkSize;
+    SInt       num_chunks       = 0;
+    MPI_Allreduce(&num_local_chunks, &num_chunks, 1, KAGEN_MPI_SINT, MPI_MAX, comm);
+
+    for (SInt chunk = 0; chunk < num_chunks; ++chunk) {
+        const SInt begin = std::min<SInt>(chunk * kChunkSize, data.size());
+        const SInt end   = std::min<SInt>(begin + kChunkSize, data.size());
+        MPI_File_write_at_all(
+            file, pos + begin * sizeof(T), data.data() + begin, static_cast<int>((end - begin) * sizeof(T)), MPI_BYTE,
+            MPI_STATUS_IGNORE);
+    }
+}
+} // namespace kagen
@@ -1,10 +1,11 @@
 #include "kagen/definitions.h"
+#include "kagen/tools/radix_sort.h"
+#include "kagen/tools/zip_iterator.h"
 
 #include <algorithm>
-#include <numeric>
 
 namespace kagen {
-inline std::pair<std::vector<SInt>, std::vector<SInt>>
+inline std::pair<XadjArray, AdjncyArray>
 BuildCSRFromEdgeList(VertexRange vertex_range, EdgeList& edges, EdgeWeights& edge_weights) {
     const SInt num_local_nodes = vertex_range.second - vertex_range.first;
     const SInt num_local_edges = edges.size();
@@ -16,25 +17,15 @@ BuildCSRFromEdgeList(VertexRange vertex_range, EdgeList& edges, EdgeWeights& edg
 
     if (!std::is_sorted(edges.begin(), edges.end(), cmp_from)) {
         // If we have edge weights, sort them the same way as the edges
-        // This not very efficient; ideally, we should probably implement some kind of zip iterator to sort edges
-        // and edge weights without extra allocation / expensive permutation step (@todo)
         if (!edge_weights.empty()) {
-            std::vector<EdgeWeights::value_type> indices(num_local_edges);
-            std::iota(indices.begin(), indices.end(), 0);
-            std::sort(indices.begin(), indices.end(), [&](const auto& lhs, const auto& rhs) {
-                return cmp_from(edges[lhs], edges[rhs]);
-            });
-            for (std::size_t e = 0; e < num_local_edges; ++e) {
-                indices[e] = edge_weights[indices[e]];
-            }
-            std::swap(edge_weights, indices);
+            ZipSort(edges, edge_weights, cmp_from);
+        } else {
+            RadixSortEdges(edges);
         }
-
-        std::sort(edges.begin(), edges.end(), cmp_from);
     }
 
-    std::vector<SInt> xadj(num_local_nodes + 1);
-    std::vector<SInt> adjncy(num_local_edges);
+    XadjArray   xadj(num_local_nodes + 1);
+    AdjncyArray adjncy(num_local_edges);
 
     SInt cur_vertex = 0;
     SInt cur_edge   = 0;
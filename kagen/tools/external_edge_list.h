@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+#include <unistd.h>
+
+#include "kagen/definitions.h"
+#include "kagen/tools/radix_sort.h"
+
+namespace kagen {
+// Edge list that is kept in scratch files: edges are written as sorted, duplicate-free runs, which are either streamed
+// in merged order (e.g., into an edge exchange) or merged back into main memory once all edges have been generated.
+// Thus, the edge list is always sorted and duplicate-free. Used to bound the size of the in-memory edge buffer of a PE,
+// see PGeneratorConfig::memory_limit.
+template <typename Edge>
+class ExternalEdgeList {
+    // Number of edges that are read from each run at once during merging
+    static constexpr std::size_t kReadBufferSize = 1 << 16;
+
+public:
+    // The rank of this PE in `comm` is part of the names of the scratch files, since multiple PEs might share the same
+    // scratch directory
+    ExternalEdgeList(std::string scratch_directory, MPI_Comm comm)
+        : scratch_directory_(std::move(scratch_directory)),
+          id_(next_id_++) {
+        MPI_Comm_rank(comm, &rank_);
+    }
+
+    ExternalEdgeList(const ExternalEdgeList&)            = delete;
+    ExternalEdgeList& operator=(const ExternalEdgeList&) = delete;
+
+    ~ExternalEdgeList() {
+        Clear();
+    }
+
+    // Sorts the edges, removes duplicates and writes them to a new run. `edges` is empty afterwards.
+    void WriteRun(std::vector<Edge>& edges) {
+        if (edges.empty()) {
+            return;
+        }
+        RadixSortAndDeduplicateEdges(edges);
+
+        const std::string filename = scratch_directory_ + "/kagen_" + std::to_string(rank_) + "_"
+                                     + std::to_string(getpid()) + "_" + std::to_string(id_) + "_"
+                                     + std::to_string(runs_.size()) + ".run";
+        std::ofstream out(filename, std::ios_base::binary | std::ios_base::trunc);
+        out.write(reinterpret_cast<const char*>(edges.data()), edges.size() * sizeof(Edge));
+        if (!out) {
+            std::remove(filename.c_str());
+            throw std::runtime_error("cannot write scratch file " + filename);
+        }
+
+        runs_.push_back({filename, edges.size()});
+        num_edges_ += edges.size();
+        edges.clear();
+    }
+
+    bool IsEmpty() const {
+        return runs_.empty();
+    }
+
+    // Number of edges in all runs, including duplicates across runs.
+    SInt GetNumberOfEdges() const {
+        return num_edges_;
+    }
+
+    // Calls `consume(edge)` for each edge of all runs in lexicographic order, skipping duplicate edges. Edges are read
+    // from the scratch files in blocks and the runs are kept, i.e., they can be streamed multiple times.
+    template <typename Consumer>
+    void ForEachEdge(Consumer&& consume) const {
+        std::vector<RunReader> readers;
+        readers.reserve(runs_.size());
+        for (const auto& run: runs_) {
+            readers.emplace_back(run);
+        }
+
+        using Entry = std::pair<Edge, std::size_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heads;
+        for (std::size_t i = 0; i < readers.size(); ++i) {
+            heads.emplace(readers[i].Next(), i);
+        }
+
+        bool has_previous = false;
+        Edge previous{};
+        while (!heads.empty()) {
+            const auto [edge, i] = heads.top();
+            heads.pop();
+
+            if (!has_previous || previous != edge) {
+                consume(edge);
+                previous     = edge;
+                has_previous = true;
+            }
+            if (readers[i].HasNext()) {
+                heads.emplace(readers[i].Next(), i);
+            }
+        }
+    }
+
+    // Merges all runs and the edges already contained in `edges` into `edges`, which is sorted and duplicate-free
+    // afterwards. Deletes the scratch files.
+    void MergeInto(std::vector<Edge>& edges) {
+        if (IsEmpty()) {
+            return;
+        }
+        WriteRun(edges);
+
+        edges.clear();
+        edges.shrink_to_fit();
+        edges.reserve(num_edges_);
+        ForEachEdge([&](const Edge& edge) { edges.push_back(edge); });
+
+        Clear();
+    }
+
+    // Deletes all runs.
+    void Clear() {
+        for (const auto& run: runs_) {
+            std::remove(run.filename.c_str());
+        }
+        runs_.clear();
+        num_edges_ = 0;
+    }
+
+private:
+    struct Run {
+        std::string filename;
+        SInt        size;
+    };
+
+    class RunReader {
+    public:
+        explicit RunReader(const Run& run)
+            : filename_(run.filename),
+              in_(run.filename, std::ios_base::binary),
+              remaining_(run.size) {
+            if (!in_) {
+                throw std::runtime_error("cannot read scratch file " + filename_);
+            }
+        }
+
+        bool HasNext() const {
+            return position_ < buffer_.size() || remaining_ > 0;
+        }
+
+        Edge Next() {
+            if (position_ == buffer_.size()) {
+                buffer_.resize(std::min<SInt>(kReadBufferSize, remaining_));
+                in_.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size() * sizeof(Edge));
+                if (!in_) {
+                    throw std::runtime_error("cannot read scratch file " + filename_);
+                }
+                remaining_ -= buffer_.size();
+                position_ = 0;
+            }
+            return buffer_[position_++];
+        }
+
+    private:
+        std::string       filename_;
+        std::ifstream     in_;
+        SInt              remaining_;
+        std::vector<Edge> buffer_;
+        std::size_t       position_ = 0;
+    };
+
+    inline static std::atomic<SInt> next_id_ = 0;
+
+    std::string      scratch_directory_;
+    int              rank_;
+    SInt             id_;
+    std::vector<Run> runs_;
+    SInt             num_edges_ = 0;
+};
+
+// Local edges of a generator that exceed its memory limit, see Generator::SetMemoryLimit()
+using SpilledEdgeList = ExternalEdgeList<EdgeList::value_type>;
+} // namespace kagen
@@ -3,22 +3,20 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
-#include <unordered_map>
 #include <vector>
 
+#include "kagen/tools/radix_sort.h"
+
 namespace kagen {
 namespace {
-inline PEID FindPEInRange(const SInt node, const std::vector<std::pair<SInt, SInt>>& ranges) {
-    for (std::size_t i = 0; i < ranges.size(); ++i) {
-        const auto& [local_from, local_to] = ranges[i];
-
-        if (local_from <= node && node < local_to) {
-            return i;
-        }
-    }
-
-    return -1;
+// Vertex ranges are consecutive, thus, the owner of a vertex can be found by binary search
+inline PEID FindPEInRange(const SInt node, const std::vector<VertexRange>& ranges) {
+    const auto it = std::upper_bound(ranges.begin(), ranges.end(), node, [](const SInt node, const VertexRange& range) {
+        return node < range.second;
+    });
+    return static_cast<PEID>(it - ranges.begin());
 }
 
 std::vector<VertexRange> AllgatherVertexRange(const VertexRange vertex_range, MPI_Comm comm) {
@@ -32,95 +30,235 @@ std::vector<VertexRange> AllgatherVertexRange(const VertexRange vertex_range, MP
 
     return ranges;
 }
-} // namespace
 
-void SortEdges(EdgeList& edge_list) {
-    std::sort(edge_list.begin(), edge_list.end());
+// Edges are sent as pairs of vertex IDs
+MPI_Datatype CreateEdgeType() {
+    MPI_Datatype edge_type;
+    MPI_Type_contiguous(2, KAGEN_MPI_VERTEXID, &edge_type);
+    MPI_Type_commit(&edge_type);
+    return edge_type;
 }
 
-void AddReverseEdges(EdgeList& edge_list, const VertexRange vertex_range, MPI_Comm comm) {
-    int rank, size;
-    MPI_Comm_rank(comm, &rank);
+// Reorders the edges such that edges to the same PE are consecutive and returns the number of edges for each PE
+template <typename Target>
+std::vector<int> BucketByTarget(EdgeList& edges, Target&& target, const PEID size) {
+    std::vector<int> counts(size);
+    for (const auto& edge: edges) {
+        ++counts[target(edge)];
+    }
+
+    std::vector<int> displs(size);
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+
+    EdgeList buckets(edges.size());
+    for (const auto& edge: edges) {
+        buckets[displs[target(edge)]++] = edge;
+    }
+    std::swap(edges, buckets);
+
+    return counts;
+}
+
+EdgeList DenseExchange(const EdgeList& send_buf, const std::vector<int>& send_counts, MPI_Comm comm) {
+    PEID size;
     MPI_Comm_size(comm, &size);
 
-    const auto ranges = AllgatherVertexRange(vertex_range, comm);
+    std::vector<int> send_displs(size);
+    std::vector<int> recv_counts(size);
+    std::vector<int> recv_displs(size);
+    std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
+
+    EdgeList     recv_buf(recv_displs.back() + recv_counts.back());
+    MPI_Datatype edge_type = CreateEdgeType();
+    MPI_Alltoallv(
+        send_buf.data(), send_counts.data(), send_displs.data(), edge_type, recv_buf.data(), recv_counts.data(),
+        recv_displs.data(), edge_type, comm);
+    MPI_Type_free(&edge_type);
 
-    const SInt edge_list_size_before = edge_list.size();
+    return recv_buf;
+}
 
-    const auto& [local_from, local_to] = ranges[rank];
-    std::unordered_map<PEID, std::vector<SInt>> message_buffers;
+// Non-blocking consensus (NBX): only PEs that exchange edges communicate. A PE may still probe for messages while
+// others have already left the exchange and send messages of the next one, thus, the messages are sent on a duplicate
+// of the caller's communicator; this also keeps them apart from messages of the caller with the same tag.
+EdgeList SparseExchange(const EdgeList& send_buf, const std::vector<int>& send_counts, MPI_Comm caller_comm) {
+    constexpr int kTag = 42;
 
-    // Each PE gets the edges that we have to that PE
-    for (const auto& [tail, head]: edge_list) {
-        if ((tail >= local_from && tail < local_to) && (head < local_from || head >= local_to)) {
-            const SInt pe = static_cast<SInt>(FindPEInRange(head, ranges));
-            message_buffers[pe].emplace_back(tail);
-            message_buffers[pe].emplace_back(head);
+    MPI_Comm comm;
+    MPI_Comm_dup(caller_comm, &comm);
+
+    PEID size;
+    MPI_Comm_size(comm, &size);
+
+    MPI_Datatype edge_type = CreateEdgeType();
+
+    std::vector<MPI_Request> requests;
+    SInt                     displ = 0;
+    for (PEID pe = 0; pe < size; ++pe) {
+        if (send_counts[pe] > 0) {
+            requests.emplace_back();
+            MPI_Issend(send_buf.data() + displ, send_counts[pe], edge_type, pe, kTag, comm, &requests.back());
+            displ += send_counts[pe];
         }
     }
 
-    std::vector<SInt> send_buf;
-    std::vector<SInt> recv_buf;
-    std::vector<int>  send_counts(size);
-    std::vector<int>  recv_counts(size);
-    std::vector<int>  send_displs(size);
-    std::vector<int>  recv_displs(size);
-    for (size_t i = 0; i < send_counts.size(); ++i) {
-        send_counts[i] = message_buffers[i].size();
-    }
+    EdgeList    recv_buf;
+    MPI_Request barrier        = MPI_REQUEST_NULL;
+    bool        barrier_active = false;
+    bool        done           = false;
+    while (!done) {
+        int        has_message;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, kTag, comm, &has_message, &status);
+        if (has_message) {
+            int count;
+            MPI_Get_count(&status, edge_type, &count);
+            const std::size_t pos = recv_buf.size();
+            recv_buf.resize(pos + count);
+            MPI_Recv(recv_buf.data() + pos, count, edge_type, status.MPI_SOURCE, kTag, comm, MPI_STATUS_IGNORE);
+        }
 
-    std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
-    const std::size_t total_send_count = send_displs.back() + send_counts.back();
-    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
-    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
-    const std::size_t total_recv_count = recv_displs.back() + recv_counts.back();
-    send_buf.reserve(total_send_count);
-    for (size_t i = 0; i < send_counts.size(); ++i) {
-        for (const auto& elem: message_buffers[i]) {
-            send_buf.push_back(elem);
+        int flag;
+        if (barrier_active) {
+            MPI_Test(&barrier, &flag, MPI_STATUS_IGNORE);
+            done = flag;
+        } else {
+            MPI_Testall(static_cast<int>(requests.size()), requests.data(), &flag, MPI_STATUSES_IGNORE);
+            if (flag) {
+                MPI_Ibarrier(comm, &barrier);
+                barrier_active = true;
+            }
         }
-        message_buffers[i].clear();
-        message_buffers[i].resize(0);
     }
-    recv_buf.resize(total_recv_count);
-    MPI_Alltoallv(
-        send_buf.data(), send_counts.data(), send_displs.data(), MPI_UINT64_T, recv_buf.data(), recv_counts.data(),
-        recv_displs.data(), MPI_UINT64_T, comm);
-    send_buf.clear();
-    send_buf.resize(0);
-    for (std::size_t i = 0; i < recv_buf.size(); i += 2) {
-        edge_list.emplace_back(recv_buf[i + 1], recv_buf[i]);
+
+    MPI_Type_free(&edge_type);
+    MPI_Comm_free(&comm);
+    return recv_buf;
+}
+
+// Edges are first sent to the PE in the same row of a 2D processor grid that is in the same column as the target PE,
+// which then forwards them along its column. Falls back to a dense exchange if the number of PEs is prime.
+template <typename Target>
+EdgeList GridExchange(EdgeList& edges, Target&& target, MPI_Comm comm) {
+    PEID rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    PEID rows = static_cast<PEID>(std::sqrt(size));
+    while (size % rows != 0) {
+        --rows;
     }
-    recv_buf.clear();
-    recv_buf.resize(0);
+    const PEID cols = size / rows;
 
-    std::sort(edge_list.begin(), edge_list.end());
+    if (rows == 1) {
+        const auto counts = BucketByTarget(edges, target, size);
+        return DenseExchange(edges, counts, comm);
+    }
 
-    // KaGen sometimes produces duplicate edges
-    auto it = std::unique(edge_list.begin(), edge_list.end());
-    edge_list.erase(it, edge_list.end());
+    MPI_Comm row_comm;
+    MPI_Comm col_comm;
+    MPI_Comm_split(comm, rank / cols, rank % cols, &row_comm);
+    MPI_Comm_split(comm, rank % cols, rank / cols, &col_comm);
 
-    const SInt edge_list_size_after = edge_list.size();
+    const auto row_counts = BucketByTarget(edges, [&](const auto& edge) { return target(edge) % cols; }, cols);
+    EdgeList   forward    = DenseExchange(edges, row_counts, row_comm);
+    { [[maybe_unused]] auto _clear = std::move(edges); }
 
-    // Generate some statistics
-    SInt edge_list_global_size_before = 0;
-    MPI_Reduce(&edge_list_size_before, &edge_list_global_size_before, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, ROOT, comm);
-    SInt edge_list_global_size_after = 0;
-    MPI_Reduce(&edge_list_size_after, &edge_list_global_size_after, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, ROOT, comm);
+    const auto col_counts = BucketByTarget(forward, [&](const auto& edge) { return target(edge) / cols; }, rows);
+    EdgeList   recv_buf   = DenseExchange(forward, col_counts, col_comm);
+
+    MPI_Comm_free(&row_comm);
+    MPI_Comm_free(&col_comm);
+    return recv_buf;
 }
 
-void AddReverseEdgesAndRedistribute(EdgeList& edge_list, const VertexRange vertex_range, MPI_Comm comm) {
-    PEID rank, size;
-    MPI_Comm_rank(comm, &rank);
+// Sends each edge to PE `target(edge)` and returns the edges received from all PEs. `edges` is consumed.
+template <typename Target>
+EdgeList ExchangeEdges(EdgeList& edges, Target&& target, const ExchangeStrategy strategy, MPI_Comm comm) {
+    PEID size;
     MPI_Comm_size(comm, &size);
 
+    EdgeList recv_buf;
+    switch (strategy) {
+        case ExchangeStrategy::DENSE: {
+            const auto counts = BucketByTarget(edges, target, size);
+            recv_buf          = DenseExchange(edges, counts, comm);
+            break;
+        }
+
+        case ExchangeStrategy::SPARSE: {
+            const auto counts = BucketByTarget(edges, target, size);
+            recv_buf          = SparseExchange(edges, counts, comm);
+            break;
+        }
+
+        case ExchangeStrategy::GRID:
+            recv_buf = GridExchange(edges, target, comm);
+            break;
+    }
+
+    { [[maybe_unused]] auto _clear = std::move(edges); }
+    return recv_buf;
+}
+} // namespace
+
+void SortEdges(EdgeList& edge_list) {
+    RadixSortEdges(edge_list);
+}
+
+void AddReverseEdges(
+    EdgeList& edge_list, const VertexRange vertex_range, const ExchangeStrategy strategy, MPI_Comm comm,
+    SpilledEdgeList* spilled_edges) {
+    const auto ranges = AllgatherVertexRange(vertex_range, comm);
+
+    const auto& [local_from, local_to] = vertex_range;
+
+    // Each PE gets the reverse edges of our edges to that PE
+    EdgeList reverse_edges;
+    auto     add_reverse_edge = [&](const auto& edge) {
+        const auto& [tail, head] = edge;
+        if ((tail >= local_from && tail < local_to) && (head < local_from || head >= local_to)) {
+            reverse_edges.emplace_back(head, tail);
+        }
+    };
+    std::for_each(edge_list.begin(), edge_list.end(), add_reverse_edge);
+    if (spilled_edges != nullptr) {
+        spilled_edges->ForEachEdge(add_reverse_edge);
+    }
+
+    const EdgeList recv_buf = ExchangeEdges(
+        reverse_edges, [&](const auto& edge) { return FindPEInRange(std::get<0>(edge), ranges); }, strategy, comm);
+
+    // Spilled edges are only merged back into memory once the exchange buffers have been released
+    if (spilled_edges != nullptr) {
+        spilled_edges->MergeInto(edge_list);
+    }
+    edge_list.insert(edge_list.end(), recv_buf.begin(), recv_buf.end());
+
+    // KaGen sometimes produces duplicate edges
+    RadixSortAndDeduplicateEdges(edge_list);
+}
+
+void RedistributeEdges(
+    EdgeList& edge_list, const VertexRange vertex_range, const ExchangeStrategy strategy, MPI_Comm comm) {
     const auto ranges = AllgatherVertexRange(vertex_range, comm);
-    const auto from   = ranges[rank].first;
-    const auto to     = ranges[rank].second;
+
+    edge_list = ExchangeEdges(
+        edge_list, [&](const auto& edge) { return FindPEInRange(std::get<0>(edge), ranges); }, strategy, comm);
+    RadixSortEdges(edge_list);
+}
+
+void AddReverseEdgesAndRedistribute(
+    EdgeList& edge_list, const VertexRange vertex_range, const ExchangeStrategy strategy, MPI_Comm comm) {
+    const auto ranges = AllgatherVertexRange(vertex_range, comm);
+    const auto from   = vertex_range.first;
+    const auto to     = vertex_range.second;
 
     // Create new edge arrays
-    std::vector<std::tuple<SInt, SInt>>              local_edges;
-    std::vector<std::vector<std::tuple<SInt, SInt>>> remote_edges(size);
+    EdgeList local_edges;
+    EdgeList remote_edges;
     for (const auto& [u, v]: edge_list) {
         if (u == v) { // Ignore self loops
             continue;
@@ -129,60 +267,24 @@ void AddReverseEdgesAndRedistribute(EdgeList& edge_list, const VertexRange verte
         if (from <= u && u < to) { // Edge starts from local vertex
             local_edges.emplace_back(u, v);
         } else { // Edge starts from remote vertex
-            const PEID owner = FindPEInRange(u, ranges);
-            remote_edges[owner].emplace_back(u, v);
+            remote_edges.emplace_back(u, v);
         }
 
         if (from <= v && v < to) {
             local_edges.emplace_back(v, u);
         } else {
-            const PEID owner = FindPEInRange(v, ranges);
-            remote_edges[owner].emplace_back(v, u);
+            remote_edges.emplace_back(v, u);
         }
     }
+    { [[maybe_unused]] auto _clear = std::move(edge_list); }
 
     // Exchange edges
-    std::vector<SInt> recv_buf;
-    std::vector<SInt> send_buf;
-    std::vector<int>  send_counts(size);
-    std::vector<int>  recv_counts(size);
-    std::vector<int>  send_displs(size);
-    std::vector<int>  recv_displs(size);
-    for (std::size_t i = 0; i < send_counts.size(); ++i) {
-        send_counts[i] = remote_edges[i].size() * 2;
-    }
-
-    std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
-    const SInt total_send_count = send_displs.back() + send_counts.back();
-    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
-    std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
-    const SInt total_recv_count = recv_displs.back() + recv_counts.back();
-
-    send_buf.reserve(total_send_count);
-    for (std::size_t i = 0; i < send_counts.size(); ++i) {
-        for (const auto& [u, v]: remote_edges[i]) {
-            send_buf.push_back(u);
-            send_buf.push_back(v);
-        }
-        { [[maybe_unused]] auto _clear = std::move(remote_edges[i]); }
-    }
-    recv_buf.resize(total_recv_count);
-    local_edges.reserve(local_edges.size() + total_recv_count / 2);
-
-    MPI_Alltoallv(
-        send_buf.data(), send_counts.data(), send_displs.data(), MPI_UNSIGNED_LONG_LONG, recv_buf.data(),
-        recv_counts.data(), recv_displs.data(), MPI_UNSIGNED_LONG_LONG, comm);
-    { [[maybe_unused]] auto _clear = std::move(send_buf); }
-
-    for (std::size_t i = 0; i < recv_buf.size(); i += 2) {
-        local_edges.emplace_back(recv_buf[i], recv_buf[i + 1]);
-    }
-    { [[maybe_unused]] auto _clear = std::move(recv_buf); }
+    const EdgeList recv_buf = ExchangeEdges(
+        remote_edges, [&](const auto& edge) { return FindPEInRange(std::get<0>(edge), ranges); }, strategy, comm);
+    local_edges.insert(local_edges.end(), recv_buf.begin(), recv_buf.end());
 
     // Deduplicate edges
-    std::sort(local_edges.begin(), local_edges.end());
-    auto it = std::unique(local_edges.begin(), local_edges.end());
-    local_edges.erase(it, local_edges.end());
+    RadixSortAndDeduplicateEdges(local_edges);
 
     // Set original edge list to new edge list
     std::swap(local_edges, edge_list);
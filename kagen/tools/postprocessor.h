@@ -2,12 +2,22 @@
 
 #include <mpi.h>
 
+#include "kagen/context.h"
 #include "kagen/definitions.h"
+#include "kagen/tools/external_edge_list.h"
 
 namespace kagen {
 void SortEdges(EdgeList& edge_list);
 
-void AddReverseEdges(EdgeList& edge_list, VertexRange vertex_range, MPI_Comm comm);
+// Adds the reverse of each edge that crosses PE boundaries, sorts the edges and removes duplicates. If given, the
+// edges in `spilled_edges` are streamed into the exchange and only merged into `edge_list` afterwards.
+void AddReverseEdges(
+    EdgeList& edge_list, VertexRange vertex_range, ExchangeStrategy strategy, MPI_Comm comm,
+    SpilledEdgeList* spilled_edges = nullptr);
 
-void AddReverseEdgesAndRedistribute(EdgeList& edge_list, VertexRange vertex_range, MPI_Comm comm);
+// Sends each edge to the PE whose vertex range contains its tail and sorts the received edges
+void RedistributeEdges(EdgeList& edge_list, VertexRange vertex_range, ExchangeStrategy strategy, MPI_Comm comm);
+
+void AddReverseEdgesAndRedistribute(
+    EdgeList& edge_list, VertexRange vertex_range, ExchangeStrategy strategy, MPI_Comm comm);
 } // namespace kagen
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+#include "kagen/definitions.h"
+
+namespace kagen {
+namespace radix_sort {
+// Bits sorted per pass
+constexpr int kDigitBits  = 8;
+constexpr int kNumBuckets = 1 << kDigitBits;
+
+// Inputs smaller than this are sorted with std::sort
+constexpr std::size_t kMinSize = 1 << 16;
+
+inline int GetMaxThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int GetThreadNum() {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+inline int SignificantBits(std::uint64_t value) {
+    int bits = 0;
+    while (value > 0) {
+        ++bits;
+        value >>= 1;
+    }
+    return bits;
+}
+
+// Stable counting sort of `src` into `dst` by the digit `(std::get<Component>(edge) >> shift) & (kNumBuckets - 1)`.
+// Returns false without touching `dst` if all elements have the same digit, i.e., if the pass would not change the
+// order of the elements.
+template <std::size_t Component, typename Edge>
+bool ScatterByDigit(const std::vector<Edge>& src, std::vector<Edge>& dst, const int shift, const int num_threads) {
+    auto digit = [shift](const Edge& edge) {
+        return (static_cast<std::uint64_t>(std::get<Component>(edge)) >> shift) & (kNumBuckets - 1);
+    };
+
+    const std::size_t        size = src.size();
+    std::vector<std::size_t> offsets(static_cast<std::size_t>(num_threads) * kNumBuckets);
+    bool                     trivial = false;
+
+#pragma omp parallel num_threads(num_threads)
+    {
+        const int         thread = GetThreadNum();
+        const std::size_t begin  = size * thread / num_threads;
+        const std::size_t end    = size * (thread + 1) / num_threads;
+        std::size_t*      local  = offsets.data() + static_cast<std::size_t>(thread) * kNumBuckets;
+
+        for (std::size_t i = begin; i < end; ++i) {
+            ++local[digit(src[i])];
+        }
+
+#pragma omp barrier
+#pragma omp single
+        {
+            // Turn counts into start offsets: buckets in ascending order, threads in ascending order within a bucket
+            std::size_t offset = 0;
+            for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+                std::size_t bucket_size = 0;
+                for (int t = 0; t < num_threads; ++t) {
+                    const std::size_t index = static_cast<std::size_t>(t) * kNumBuckets + bucket;
+                    const std::size_t count = offsets[index];
+                    offsets[index]          = offset;
+                    offset += count;
+                    bucket_size += count;
+                }
+                trivial |= (bucket_size == size);
+            }
+        }
+
+        if (!trivial) {
+            for (std::size_t i = begin; i < end; ++i) {
+                dst[local[digit(src[i])]++] = src[i];
+            }
+        }
+    }
+
+    return !trivial;
+}
+} // namespace radix_sort
+
+// Sorts a list of edges lexicographically using a parallel LSD radix sort with `num_threads` threads (by default, as
+// many threads as OpenMP provides). Only the significant bits of the largest vertex ID are sorted; requires an
+// additional buffer with the size of the edge list. Works on any vector of 2-tuples of non-negative integers, e.g.,
+// EdgeList.
+template <typename Edge>
+void RadixSortEdges(std::vector<Edge>& edges, int num_threads = radix_sort::GetMaxThreads()) {
+    using namespace radix_sort;
+
+    if (edges.size() < kMinSize) {
+        std::sort(edges.begin(), edges.end());
+        return;
+    }
+
+    num_threads = std::max(num_threads, 1);
+
+    std::uint64_t max_tail = 0;
+    std::uint64_t max_head = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(max : max_tail, max_head)
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        max_tail = std::max<std::uint64_t>(max_tail, std::get<0>(edges[i]));
+        max_head = std::max<std::uint64_t>(max_head, std::get<1>(edges[i]));
+    }
+
+    std::vector<Edge> buffer(edges.size());
+
+    // Least significant digits first: head, then tail
+    for (int shift = 0; shift < SignificantBits(max_head); shift += kDigitBits) {
+        if (ScatterByDigit<1>(edges, buffer, shift, num_threads)) {
+            std::swap(edges, buffer);
+        }
+    }
+    for (int shift = 0; shift < SignificantBits(max_tail); shift += kDigitBits) {
+        if (ScatterByDigit<0>(edges, buffer, shift, num_threads)) {
+            std::swap(edges, buffer);
+        }
+    }
+}
+
+// Sorts a list of edges lexicographically and removes duplicate edges.
+template <typename Edge>
+void RadixSortAndDeduplicateEdges(std::vector<Edge>& edges, const int num_threads = radix_sort::GetMaxThreads()) {
+    RadixSortEdges(edges, num_threads);
+    auto it = std::unique(edges.begin(), edges.end());
+    edges.erase(it, edges.end());
+}
+} // namespace kagen
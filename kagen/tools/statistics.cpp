@@ -10,6 +10,9 @@
 
 #include <mpi.h>
 
+#include "kagen/tools/radix_sort.h"
+#include "kagen/tools/zip_iterator.h"
+
 namespace kagen {
 // First invalid node on the last PE is the number of nodes in the graph
 SInt FindNumberOfGlobalNodes(const VertexRange vertex_range, MPI_Comm comm) {
@@ -267,10 +270,15 @@ void PrintBasicStatistics(const EdgeList& edges, const VertexRange vertex_range,
     PrintBasicStatistics(vertex_range.second - vertex_range.first, edges.size(), root, comm);
 }
 
-void PrintAdvancedStatistics(EdgeList& edges, const VertexRange vertex_range, const bool root, MPI_Comm comm) {
+void PrintAdvancedStatistics(
+    EdgeList& edges, EdgeWeights& edge_weights, const VertexRange vertex_range, const bool root, MPI_Comm comm) {
     // Sort edges for degree computation
     if (!std::is_sorted(edges.begin(), edges.end())) {
-        std::sort(edges.begin(), edges.end());
+        if (!edge_weights.empty()) {
+            ZipSort(edges, edge_weights);
+        } else {
+            RadixSortEdges(edges);
+        }
     }
 
     // Compute degree statistics
@@ -38,5 +38,7 @@ void PrintBasicStatistics(
 
 void PrintBasicStatistics(const EdgeList& edges, VertexRange vertex_range, bool root, MPI_Comm comm);
 
-void PrintAdvancedStatistics(EdgeList& edges, VertexRange vertex_range, bool root, MPI_Comm comm);
+// Sorts the edges (and their weights, if any) for the degree computation
+void PrintAdvancedStatistics(
+    EdgeList& edges, EdgeWeights& edge_weights, VertexRange vertex_range, bool root, MPI_Comm comm);
 } // namespace kagen
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace kagen {
+// Proxy reference to a pair of elements from two different ranges: assigning to it or swapping it moves both elements.
+template <typename First, typename Second>
+class ZipReference {
+public:
+    using value_type = std::pair<First, Second>;
+
+    ZipReference(First& first, Second& second) : first(first), second(second) {}
+
+    ZipReference(const ZipReference& other) = default;
+
+    ZipReference& operator=(const ZipReference& other) {
+        first  = other.first;
+        second = other.second;
+        return *this;
+    }
+
+    ZipReference& operator=(value_type&& value) {
+        first  = std::move(value.first);
+        second = std::move(value.second);
+        return *this;
+    }
+
+    operator value_type() const {
+        return {first, second};
+    }
+
+    friend void swap(ZipReference lhs, ZipReference rhs) {
+        using std::swap;
+        swap(lhs.first, rhs.first);
+        swap(lhs.second, rhs.second);
+    }
+
+    First&  first;
+    Second& second;
+};
+
+// Random access iterator over two ranges of the same length, e.g., edges and their weights. Dereferencing yields a
+// ZipReference, whose elements are accessed through `.first` and `.second` just like the elements of its value_type.
+template <typename FirstIterator, typename SecondIterator>
+class ZipIterator {
+    using First  = typename std::iterator_traits<FirstIterator>::value_type;
+    using Second = typename std::iterator_traits<SecondIterator>::value_type;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::pair<First, Second>;
+    using reference         = ZipReference<First, Second>;
+    using pointer           = void;
+
+    ZipIterator(FirstIterator first, SecondIterator second) : first_(first), second_(second) {}
+
+    reference operator*() const {
+        return {*first_, *second_};
+    }
+
+    reference operator[](const difference_type n) const {
+        return *(*this + n);
+    }
+
+    ZipIterator& operator++() {
+        return *this += 1;
+    }
+
+    ZipIterator operator++(int) {
+        ZipIterator copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    ZipIterator& operator--() {
+        return *this -= 1;
+    }
+
+    ZipIterator operator--(int) {
+        ZipIterator copy = *this;
+        --*this;
+        return copy;
+    }
+
+    ZipIterator& operator+=(const difference_type n) {
+        first_ += n;
+        second_ += n;
+        return *this;
+    }
+
+    ZipIterator& operator-=(const difference_type n) {
+        return *this += -n;
+    }
+
+    friend ZipIterator operator+(ZipIterator it, const difference_type n) {
+        return it += n;
+    }
+
+    friend ZipIterator operator+(const difference_type n, ZipIterator it) {
+        return it += n;
+    }
+
+    friend ZipIterator operator-(ZipIterator it, const difference_type n) {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ - rhs.first_;
+    }
+
+    friend bool operator==(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ == rhs.first_;
+    }
+
+    friend bool operator!=(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ != rhs.first_;
+    }
+
+    friend bool operator<(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ < rhs.first_;
+    }
+
+    friend bool operator>(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ > rhs.first_;
+    }
+
+    friend bool operator<=(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ <= rhs.first_;
+    }
+
+    friend bool operator>=(const ZipIterator& lhs, const ZipIterator& rhs) {
+        return lhs.first_ >= rhs.first_;
+    }
+
+private:
+    FirstIterator  first_;
+    SecondIterator second_;
+};
+
+// Sorts `keys` with respect to `comp` and applies the same permutation to `values`, in place.
+template <typename Key, typename Value, typename Compare>
+void ZipSort(std::vector<Key>& keys, std::vector<Value>& values, Compare comp) {
+    using Iterator = ZipIterator<typename std::vector<Key>::iterator, typename std::vector<Value>::iterator>;
+
+    std::sort(
+        Iterator(keys.begin(), values.begin()), Iterator(keys.end(), values.end()),
+        [&](const auto& lhs, const auto& rhs) { return comp(lhs.first, rhs.first); });
+}
+
+template <typename Key, typename Value>
+void ZipSort(std::vector<Key>& keys, std::vector<Value>& values) {
+    ZipSort(keys, values, std::less<>{});
+}
+} // namespace kagen
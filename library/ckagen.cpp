@@ -46,7 +46,7 @@ kagen_index* kagen_result_csr_xadj(kagen_result* result, size_t* nvertices) {
     return result->result_ptr->xadj.data();
 }
 
-kagen_index* kagen_result_csr_adjncy(kagen_result* result, size_t* nedges) {
+kagen_vertex* kagen_result_csr_adjncy(kagen_result* result, size_t* nedges) {
     if (nedges != nullptr) {
         *nedges = result->result_ptr->adjncy.size();
     }
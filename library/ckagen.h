@@ -4,19 +4,26 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "kagen_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef unsigned long long kagen_index;
 typedef long long          kagen_weight;
+#ifdef KAGEN_32BIT_VERTEX_IDS
+typedef unsigned int kagen_vertex;
+#else  // KAGEN_32BIT_VERTEX_IDS
+typedef unsigned long long kagen_vertex;
+#endif // KAGEN_32BIT_VERTEX_IDS
 
 typedef struct kagen_obj    kagen_obj;
 typedef struct kagen_result kagen_result;
 
 struct kagen_edge {
-    kagen_index source;
-    kagen_index target;
+    kagen_vertex source;
+    kagen_vertex target;
 };
 typedef struct kagen_edge kagen_edge;
 
@@ -26,7 +33,7 @@ void       kagen_free(kagen_obj* gen);
 void          kagen_result_vertex_range(kagen_result* result, kagen_index* begin, kagen_index* end);
 kagen_edge*   kagen_result_edge_list(kagen_result* result, size_t* nedges);
 kagen_index*  kagen_result_csr_xadj(kagen_result* result, size_t* nvertices);
-kagen_index*  kagen_result_csr_adjncy(kagen_result* result, size_t* nedges);
+kagen_vertex* kagen_result_csr_adjncy(kagen_result* result, size_t* nedges);
 kagen_weight* kagen_result_vertex_weights(kagen_result* result, size_t* size);
 kagen_weight* kagen_result_edge_weights(kagen_result* result, size_t* size);
 void          kagen_result_free(kagen_result* result);
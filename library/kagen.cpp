@@ -54,6 +54,15 @@ void KaGen::SetNumberOfChunks(const SInt k) {
     config_->k = k;
 }
 
+void KaGen::SetNumberOfThreads(const int num_threads) {
+    config_->num_threads = num_threads;
+}
+
+void KaGen::SetMemoryLimit(const SInt memory_limit, const std::string& scratch_directory) {
+    config_->memory_limit      = memory_limit;
+    config_->scratch_directory = scratch_directory;
+}
+
 void KaGen::UseEdgeListRepresentation() {
     representation_ = GraphRepresentation::EDGE_LIST;
 }
@@ -74,6 +83,12 @@ KaGenResult KaGen::GenerateFromOptionString(const std::string& options) {
     return GenericGenerateFromOptionString(options, *config_, representation_, comm_).tuple();
 }
 
+VertexRange KaGen::StreamFromOptionString(
+    const std::string& options, std::function<void(const EdgeList&)> consumer, const SInt batch_size) {
+    CallbackEdgeSink sink(std::move(consumer));
+    return StreamGraph(CreateConfigFromString(options, *config_), sink, batch_size, comm_);
+}
+
 KaGenResult KaGen::GenerateDirectedGNM(const SInt n, const SInt m, const bool self_loops) {
     config_->generator  = GeneratorType::GNM_DIRECTED;
     config_->n          = n;
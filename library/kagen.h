@@ -8,6 +8,7 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <numeric>
@@ -17,13 +18,20 @@
 
 #include <mpi.h>
 
+#include "kagen_config.h"
+
 namespace kagen {
 struct PGeneratorConfig;
 enum class GraphRepresentation;
 
 using SInt          = unsigned long long;
 using SSInt         = long long;
-using EdgeList      = std::vector<std::tuple<SInt, SInt>>;
+#ifdef KAGEN_32BIT_VERTEX_IDS
+using VertexID = unsigned int;
+#else  // KAGEN_32BIT_VERTEX_IDS
+using VertexID = SInt;
+#endif // KAGEN_32BIT_VERTEX_IDS
+using EdgeList      = std::vector<std::tuple<VertexID, VertexID>>;
 using VertexRange   = std::pair<SInt, SInt>;
 using PEID          = int;
 using HPFloat       = long double;
@@ -34,7 +42,7 @@ using Coordinates   = std::pair<Coordinates2D, Coordinates3D>;
 using VertexWeights = std::vector<SSInt>;
 using EdgeWeights   = std::vector<SSInt>;
 using XadjArray     = std::vector<SInt>;
-using AdjncyArray   = std::vector<SInt>;
+using AdjncyArray   = std::vector<VertexID>;
 
 struct KaGenResult {
     inline KaGenResult() : vertex_range(0, 0) {}
@@ -49,7 +57,7 @@ struct KaGenResult {
           coordinates_2d(std::move(std::get<6>(result).first)),
           coordinates_3d(std::move(std::get<6>(result).second)) {}
 
-    template <typename T = SInt>
+    template <typename T = VertexID>
     std::vector<std::tuple<T, T>> TakeEdges() {
         return TakeVector<std::tuple<T, T>>(edges);
     }
@@ -59,7 +67,7 @@ struct KaGenResult {
         return TakeVector<T>(xadj);
     }
 
-    template <typename T = SInt>
+    template <typename T = VertexID>
     std::vector<T> TakeAdjncy() {
         return TakeVector<T>(adjncy);
     }
@@ -162,6 +170,29 @@ public:
      */
     void SetNumberOfChunks(SInt k);
 
+    /*!
+     * Controls the number of threads that each PE uses for graph generation (Default: 1). For communication-free
+     * generators (GNM, GNP, RGG, grid graphs), threads act as additional PEs, i.e., they generate the chunks of their PE
+     * concurrently. Kronecker graphs split the edges of each PE among its threads, and METIS and text edge list inputs
+     * split the byte range of each PE among its threads. Other generators use a single thread for generation, but all
+     * generators sort their edges with all threads during finalization.
+     *
+     * @param num_threads Number of threads per PE.
+     */
+    void SetNumberOfThreads(int num_threads);
+
+    /*!
+     * Limits the memory used for edges that each PE buffers during graph generation (Default: no limit). Edges
+     * exceeding the limit are written to sorted runs in scratch files, which removes duplicate edges. Generators that
+     * exchange edges during finalization (RHG, BA) stream the runs into the exchange, all others merge them back into
+     * memory before the graph is finalized. This mostly helps generators with a global finalization step, e.g., RMAT
+     * and Kronecker graphs. If the PE uses multiple threads, each thread gets an equal share of the limit.
+     *
+     * @param memory_limit Maximum size of buffered edges per PE in bytes, or 0 to disable the limit.
+     * @param scratch_directory Directory for the scratch files; should be local to each compute node.
+     */
+    void SetMemoryLimit(SInt memory_limit, const std::string& scratch_directory = "/tmp");
+
     /*!
      * Represents the generated graph as a list of edges (from, to).
      * This representation requires 2 * |E| memory and is the default representation.
@@ -173,6 +204,8 @@ public:
      * This representation requires |V| + |E| memory. However, not all generators support this representation;
      * for generators that do not support it, KaGen first generates the graph as a list of edges, sorts it and
      * then builds the CSR data structures. This requires |V|+3|E| memory and |E|*log(|E|) time.
+     * The GNM, GNP, RGG and grid generators build the CSR data structures directly by running twice, first counting
+     * vertex degrees, then placing the edges; this requires |V|+|E| memory at the cost of generating each edge twice.
      */
     void UseCSRRepresentation();
 
@@ -224,6 +257,20 @@ public:
      */
     KaGenResult GenerateFromOptionString(const std::string& options);
 
+    /*!
+     * Generates a graph with options given by a string of options (see GenerateFromOptionString()), but instead of
+     * materializing the edge list, the local edges are passed to `consumer` in batches of at most `batch_size` edges.
+     * Thus, the graph can be larger than the available memory. Only supported by communication-free generators, i.e.,
+     * gnm_undirected, gnm_directed, gnp_undirected, gnp_directed, rgg2d, rgg3d, grid2d and grid3d.
+     *
+     * @type options Options string with key=value pairs.
+     * @type consumer Callback that is invoked with each batch of edges; the batch is invalidated once it returns.
+     * @type batch_size Maximum number of edges per batch.
+     * @return The local vertex range.
+     */
+    VertexRange StreamFromOptionString(
+        const std::string& options, std::function<void(const EdgeList&)> consumer, SInt batch_size = 1 << 20);
+
     KaGenResult GenerateDirectedGNM(SInt n, SInt m, bool self_loops = false);
 
     KaGenResult GenerateUndirectedGNM(SInt n, SInt m, bool self_loops = false);
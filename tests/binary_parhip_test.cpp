@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+void TestBinaryParhipRoundTrip(
+    const bool vertex_weights, const bool edge_weights, const StaticGraphDistribution distribution) {
+    RoundTrip round_trip;
+    round_trip.output_format = OutputFormat::BINARY_PARHIP;
+    round_trip.input_format  = StaticGraphFormat::BINARY_PARHIP;
+    round_trip.output_file   = "binary_parhip_test";
+    round_trip.input_file    = "binary_parhip_test.bgf";
+    round_trip.distribution  = distribution;
+    if (vertex_weights) {
+        round_trip.vertex_weight = [](const SInt u) {
+            return -static_cast<SSInt>(u);
+        };
+    }
+    if (edge_weights) {
+        round_trip.edge_weight = [](const SInt u, const SInt v) {
+            return static_cast<SSInt>(u) - static_cast<SSInt>(v);
+        };
+    }
+    TestRoundTrip(round_trip);
+}
+} // namespace
+
+TEST(BinaryParhipTest, round_trip_unweighted) {
+    TestBinaryParhipRoundTrip(false, false, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(BinaryParhipTest, round_trip_with_vertex_weights) {
+    TestBinaryParhipRoundTrip(true, false, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(BinaryParhipTest, round_trip_with_edge_weights) {
+    TestBinaryParhipRoundTrip(false, true, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(BinaryParhipTest, round_trip_with_weights_and_balanced_edges) {
+    TestBinaryParhipRoundTrip(true, true, StaticGraphDistribution::BALANCE_EDGES);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "kagen/io/buffered_writer.h"
+
+using namespace kagen;
+
+namespace {
+// Formats `value` with BufferedTextOutput::WriteInt() resp. BufferedTextOutput::WriteFloat()
+template <typename T>
+std::string Format(const T value) {
+    std::vector<char> memory;
+    {
+        BufferedTextOutput<> out(tag::memory, memory);
+        if constexpr (std::is_integral_v<T>) {
+            out.WriteInt(value);
+        } else {
+            out.WriteFloat(value);
+        }
+    }
+    return std::string(memory.begin(), memory.end());
+}
+
+std::string Printf(const double value) {
+    char buffer[512];
+    std::snprintf(buffer, sizeof(buffer), "%.5f", value);
+    return buffer;
+}
+
+template <typename Int>
+void ExpectIntLikeToString(const std::vector<Int>& values) {
+    for (const Int value: values) {
+        EXPECT_EQ(Format(value), std::to_string(value));
+    }
+}
+
+void ExpectFloatLikePrintf(const std::vector<double>& values) {
+    for (const double value: values) {
+        EXPECT_EQ(Format(value), Printf(value)) << "value " << value;
+    }
+}
+} // namespace
+
+TEST(BufferedWriterTest, formats_signed_integers) {
+    std::vector<std::int64_t> values = {
+        0, 1, -1, 9, -9, 10, -10, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max(),
+        std::numeric_limits<std::int64_t>::min() + 1};
+    for (std::int64_t power = 10; power <= std::numeric_limits<std::int64_t>::max() / 10; power *= 10) {
+        values.insert(values.end(), {power - 1, power, power + 1, -power + 1, -power, -power - 1});
+    }
+    ExpectIntLikeToString(values);
+
+    ExpectIntLikeToString<std::int32_t>(
+        {0, -1, std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()});
+}
+
+TEST(BufferedWriterTest, formats_unsigned_integers) {
+    std::vector<std::uint64_t> values = {0, 1, 9, 10, std::numeric_limits<std::uint64_t>::max()};
+    for (std::uint64_t power = 10; power <= std::numeric_limits<std::uint64_t>::max() / 10; power *= 10) {
+        values.insert(values.end(), {power - 1, power, power + 1});
+    }
+    ExpectIntLikeToString(values);
+
+    ExpectIntLikeToString<std::uint32_t>({0, std::numeric_limits<std::uint32_t>::max()});
+}
+
+TEST(BufferedWriterTest, formats_exact_ties_like_printf) {
+    // k / 64 for odd k has six decimal places ending in 5, i.e., it is exactly halfway between two outputs
+    std::vector<double> values;
+    for (int k = 1; k < 64 * 4; k += 2) {
+        values.push_back(k / 64.0);
+        values.push_back(-k / 64.0);
+        values.push_back(123456789.0 + k / 64.0);
+    }
+    ExpectFloatLikePrintf(values);
+}
+
+TEST(BufferedWriterTest, formats_carries_into_the_integral_part_like_printf) {
+    ExpectFloatLikePrintf(
+        {0.999995, 0.9999951, 0.999999, 9.999996, 99999.999999, -0.999999, -9.999996, 1e14 - 0.000001,
+         std::nextafter(1.0, 0.0), std::nextafter(1e14, 0.0)});
+}
+
+TEST(BufferedWriterTest, formats_zeros_like_printf) {
+    ExpectFloatLikePrintf({0.0, -0.0, 0.000001, -0.000001, 0.000004, -0.000004, 0.000005, -0.000005, 1e-300, -1e-300});
+}
+
+TEST(BufferedWriterTest, formats_large_and_special_values_like_printf) {
+    ExpectFloatLikePrintf(
+        {1e15, -1e15, std::nextafter(1e15, 0.0), 1.5e15 + 0.25, 1e20, -1e20, 1e300,
+         std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(),
+         std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+         std::numeric_limits<double>::quiet_NaN()});
+}
+
+TEST(BufferedWriterTest, formats_random_values_like_printf) {
+    std::mt19937_64                        gen(42);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int>     exponent(-8, 16);
+
+    std::vector<double> values;
+    for (int i = 0; i < (1 << 14); ++i) {
+        values.push_back(std::ldexp(mantissa(gen), exponent(gen) * 3));
+    }
+    ExpectFloatLikePrintf(values);
+}
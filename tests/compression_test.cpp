@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifdef KAGEN_ZLIB_FOUND
+    #include <zlib.h>
+#endif // KAGEN_ZLIB_FOUND
+#ifdef KAGEN_ZSTD_FOUND
+    #include <zstd.h>
+#endif // KAGEN_ZSTD_FOUND
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+#include "kagen/io/compression.h"
+#include "kagen/io/io.h"
+
+using namespace kagen;
+
+namespace {
+std::string ReadFile(const std::string& filename) {
+    std::ifstream in(filename, std::ios_base::binary);
+    EXPECT_TRUE(in) << "cannot read " << filename;
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Decompresses all gzip members resp. zstd frames of `compressed`
+std::string Decompress(const std::string& compressed, const OutputCompression compression) {
+    std::string decompressed;
+
+    switch (compression) {
+        case OutputCompression::NONE:
+            return compressed;
+
+        case OutputCompression::GZIP: {
+#ifdef KAGEN_ZLIB_FOUND
+            std::vector<char> buffer(1 << 16);
+            z_stream          stream{};
+            inflateInit2(&stream, 15 + 16);
+            stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+            stream.avail_in = static_cast<uInt>(compressed.size());
+            while (stream.avail_in > 0) {
+                stream.next_out  = reinterpret_cast<Bytef*>(buffer.data());
+                stream.avail_out = static_cast<uInt>(buffer.size());
+                const int status = inflate(&stream, Z_NO_FLUSH);
+                decompressed.append(buffer.data(), buffer.size() - stream.avail_out);
+
+                if (status == Z_STREAM_END) { // Next member
+                    inflateReset(&stream);
+                } else if (status != Z_OK) {
+                    ADD_FAILURE() << "invalid gzip stream";
+                    break;
+                }
+            }
+            inflateEnd(&stream);
+#endif // KAGEN_ZLIB_FOUND
+            break;
+        }
+
+        case OutputCompression::ZSTD: {
+#ifdef KAGEN_ZSTD_FOUND
+            std::vector<char> buffer(1 << 16);
+            ZSTD_DStream*     stream = ZSTD_createDStream();
+            ZSTD_inBuffer     in     = {compressed.data(), compressed.size(), 0};
+            while (in.pos < in.size) {
+                ZSTD_outBuffer out    = {buffer.data(), buffer.size(), 0};
+                const auto     status = ZSTD_decompressStream(stream, &out, &in);
+                decompressed.append(buffer.data(), out.pos);
+
+                if (ZSTD_isError(status)) {
+                    ADD_FAILURE() << "invalid zstd stream";
+                    break;
+                }
+            }
+            ZSTD_freeDStream(stream);
+#endif // KAGEN_ZSTD_FOUND
+            break;
+        }
+    }
+
+    return decompressed;
+}
+
+// Writes the graph uncompressed and with `compression`, which must decompress to the same contents
+void TestCompression(
+    PGeneratorConfig config, const OutputCompression compression, const bool single_file, const OutputHeader header) {
+    if (!IsCompressionAvailable(compression)) {
+        GTEST_SKIP() << "KaGen was built without " << compression << " support";
+    }
+
+    PEID rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    config.quiet              = true;
+    config.statistics_level   = StatisticsLevel::NONE;
+    config.output_file        = "compression_test";
+    config.output_single_file = single_file;
+    config.output_header      = header;
+
+    Graph graph = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+
+    config.output_compression = OutputCompression::NONE;
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+    config.output_compression = compression;
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+
+    // Each PE checks its own file when writing distributed output, otherwise the root checks the whole file
+    const std::string extension = config.output_format == OutputFormat::DOT ? ".dot" : ".edgelist";
+    const std::string filename  = "compression_test" + extension + (single_file ? "" : "." + std::to_string(rank));
+    if (!single_file || rank == ROOT) {
+        const std::string expected = ReadFile(filename);
+        const std::string actual   = Decompress(ReadFile(filename + GetCompressionExtension(compression)), compression);
+
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+PGeneratorConfig CreateEdgeListConfig() {
+    PGeneratorConfig config;
+    config.generator     = GeneratorType::GNM_UNDIRECTED;
+    config.n             = 1 << 12;
+    config.m             = 1 << 15;
+    config.output_format = OutputFormat::EDGE_LIST;
+    return config;
+}
+
+// DOT files have a footer that the root PE writes behind the bodies of all PEs; coordinates are written as floats
+PGeneratorConfig CreateDotConfig() {
+    PGeneratorConfig config;
+    config.generator     = GeneratorType::RGG_2D;
+    config.n             = 1 << 12;
+    config.m             = 1 << 15;
+    config.coordinates   = true;
+    config.output_format = OutputFormat::DOT;
+    return config;
+}
+} // namespace
+
+TEST(CompressionTest, gzip_edge_list) {
+    TestCompression(CreateEdgeListConfig(), OutputCompression::GZIP, true, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, gzip_edge_list_distributed) {
+    TestCompression(CreateEdgeListConfig(), OutputCompression::GZIP, false, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, gzip_dot) {
+    TestCompression(CreateDotConfig(), OutputCompression::GZIP, true, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, gzip_dot_distributed) {
+    TestCompression(CreateDotConfig(), OutputCompression::GZIP, false, OutputHeader::ALWAYS);
+}
+
+TEST(CompressionTest, zstd_edge_list) {
+    TestCompression(CreateEdgeListConfig(), OutputCompression::ZSTD, true, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, zstd_edge_list_distributed) {
+    TestCompression(CreateEdgeListConfig(), OutputCompression::ZSTD, false, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, zstd_dot) {
+    TestCompression(CreateDotConfig(), OutputCompression::ZSTD, true, OutputHeader::ROOT);
+}
+
+TEST(CompressionTest, zstd_dot_distributed) {
+    TestCompression(CreateDotConfig(), OutputCompression::ZSTD, false, OutputHeader::ALWAYS);
+}
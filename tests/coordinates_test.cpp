@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+
+#include "gather.h"
+
+using namespace kagen;
+
+namespace {
+// The grid must have at least one row per chunk in each dimension, i.e., at least 16 for 2D and 8 for 3D grids
+PGeneratorConfig CreateGridConfig(const GeneratorType type, const int num_threads) {
+    PGeneratorConfig config;
+    config.generator        = type;
+    config.grid_x           = type == GeneratorType::GRID_2D ? 64 : 24;
+    config.grid_y           = type == GeneratorType::GRID_2D ? 48 : 16;
+    config.grid_z           = 16;
+    config.p                = 1.0;
+    config.coordinates      = true;
+    config.num_threads      = num_threads;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+    return config;
+}
+
+// Returns the position of a coordinate on the integer grid
+SInt ToGridPosition(const HPFloat coordinate, const SInt dimension) {
+    return static_cast<SInt>(std::llround(coordinate * dimension));
+}
+
+// Each PE must store the coordinates of its own vertices exactly once, and the coordinates must belong to the vertex
+// IDs, i.e., the endpoints of each edge must be neighbors on the grid
+void TestGrid2DCoordinates(const int num_threads) {
+    const PGeneratorConfig config = CreateGridConfig(GeneratorType::GRID_2D, num_threads);
+    const Graph            graph  = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+
+    const SInt num_local_vertices = graph.vertex_range.second - graph.vertex_range.first;
+    ASSERT_EQ(graph.coordinates.first.size(), num_local_vertices);
+
+    std::vector<std::tuple<SInt, SInt>> positions;
+    for (const auto& [x, y]: AllgatherVector(graph.coordinates.first)) {
+        positions.emplace_back(ToGridPosition(x, config.grid_x), ToGridPosition(y, config.grid_y));
+    }
+
+    std::vector<std::tuple<SInt, SInt>> sorted_positions = positions;
+    std::sort(sorted_positions.begin(), sorted_positions.end());
+    std::vector<std::tuple<SInt, SInt>> expected_positions;
+    for (SInt x = 0; x < config.grid_x; ++x) {
+        for (SInt y = 0; y < config.grid_y; ++y) {
+            expected_positions.emplace_back(x, y);
+        }
+    }
+    EXPECT_EQ(sorted_positions, expected_positions);
+
+    for (const auto& [u, v]: graph.edges) {
+        const auto [ux, uy] = positions[u];
+        const auto [vx, vy] = positions[v];
+        const SInt distance = std::max(ux, vx) - std::min(ux, vx) + std::max(uy, vy) - std::min(uy, vy);
+        EXPECT_EQ(distance, 1) << "edge " << u << " -> " << v;
+    }
+}
+
+void TestGrid3DCoordinates(const int num_threads) {
+    const PGeneratorConfig config = CreateGridConfig(GeneratorType::GRID_3D, num_threads);
+    const Graph            graph  = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+
+    const SInt num_local_vertices = graph.vertex_range.second - graph.vertex_range.first;
+    ASSERT_EQ(graph.coordinates.second.size(), num_local_vertices);
+
+    std::vector<std::tuple<SInt, SInt, SInt>> positions;
+    for (const auto& [x, y, z]: AllgatherVector(graph.coordinates.second)) {
+        positions.emplace_back(
+            ToGridPosition(x, config.grid_x), ToGridPosition(y, config.grid_y), ToGridPosition(z, config.grid_z));
+    }
+
+    std::vector<std::tuple<SInt, SInt, SInt>> sorted_positions = positions;
+    std::sort(sorted_positions.begin(), sorted_positions.end());
+    std::vector<std::tuple<SInt, SInt, SInt>> expected_positions;
+    for (SInt x = 0; x < config.grid_x; ++x) {
+        for (SInt y = 0; y < config.grid_y; ++y) {
+            for (SInt z = 0; z < config.grid_z; ++z) {
+                expected_positions.emplace_back(x, y, z);
+            }
+        }
+    }
+    EXPECT_EQ(sorted_positions, expected_positions);
+
+    for (const auto& [u, v]: graph.edges) {
+        const auto [ux, uy, uz] = positions[u];
+        const auto [vx, vy, vz] = positions[v];
+        const SInt distance     = std::max(ux, vx) - std::min(ux, vx) + std::max(uy, vy) - std::min(uy, vy)
+                              + std::max(uz, vz) - std::min(uz, vz);
+        EXPECT_EQ(distance, 1) << "edge " << u << " -> " << v;
+    }
+}
+
+// Generators that build their CSR representation in two passes must report the same coordinates as for edge lists
+void TestCoordinatesOfTwoPassCSR(PGeneratorConfig config) {
+    config.coordinates      = true;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+
+    const Graph edge_list = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+    const Graph csr       = Generate(config, GraphRepresentation::CSR, MPI_COMM_WORLD);
+
+    const SInt num_local_vertices = edge_list.vertex_range.second - edge_list.vertex_range.first;
+    EXPECT_EQ(edge_list.coordinates.first.size() + edge_list.coordinates.second.size(), num_local_vertices);
+    EXPECT_EQ(csr.vertex_range, edge_list.vertex_range);
+    EXPECT_EQ(csr.coordinates, edge_list.coordinates);
+
+    // Neighborhoods of the two-pass CSR representation are in the order in which the edges were generated
+    EdgeList expected_edges = ToEdgeList(edge_list);
+    EdgeList actual_edges   = ToEdgeList(csr);
+    std::sort(expected_edges.begin(), expected_edges.end());
+    std::sort(actual_edges.begin(), actual_edges.end());
+    EXPECT_EQ(actual_edges, expected_edges);
+}
+} // namespace
+
+TEST(CoordinatesTest, grid2d) {
+    TestGrid2DCoordinates(1);
+}
+
+TEST(CoordinatesTest, grid2d_with_multiple_threads) {
+    TestGrid2DCoordinates(4);
+}
+
+TEST(CoordinatesTest, grid3d) {
+    TestGrid3DCoordinates(1);
+}
+
+TEST(CoordinatesTest, grid3d_with_multiple_threads) {
+    TestGrid3DCoordinates(4);
+}
+
+TEST(CoordinatesTest, rgg2d_two_pass_csr) {
+    PGeneratorConfig config;
+    config.generator = GeneratorType::RGG_2D;
+    config.n         = 1 << 12;
+    config.r         = 0.02;
+    TestCoordinatesOfTwoPassCSR(config);
+}
+
+TEST(CoordinatesTest, rgg3d_two_pass_csr) {
+    PGeneratorConfig config;
+    config.generator = GeneratorType::RGG_3D;
+    config.n         = 1 << 12;
+    config.r         = 0.08;
+    TestCoordinatesOfTwoPassCSR(config);
+}
+
+TEST(CoordinatesTest, grid2d_two_pass_csr) {
+    TestCoordinatesOfTwoPassCSR(CreateGridConfig(GeneratorType::GRID_2D, 1));
+}
+
+TEST(CoordinatesTest, grid3d_two_pass_csr) {
+    TestCoordinatesOfTwoPassCSR(CreateGridConfig(GeneratorType::GRID_3D, 1));
+}
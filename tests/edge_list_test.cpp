@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+
+#include "gather.h"
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+// Writes a random graph in `output_format` and loads it as an edge list
+void TestEdgeListRoundTrip(
+    const OutputFormat output_format, const OutputHeader output_header, const StaticGraphFormat input_format,
+    const StaticGraphDistribution distribution) {
+    const std::string extension = (output_format == OutputFormat::EDGE_LIST) ? "edgelist" : "binaryedgelist";
+
+    RoundTrip round_trip;
+    round_trip.output_format = output_format;
+    round_trip.input_format  = input_format;
+    round_trip.output_file   = "edge_list_test";
+    round_trip.input_file    = "edge_list_test." + extension;
+    round_trip.output_header = output_header;
+    round_trip.distribution  = distribution;
+    TestRoundTrip(round_trip);
+}
+
+// Loads a directed SNAP style edge list with comments, tabs and duplicate edges, with and without adding reverse edges
+void TestSnapEdgeList(const StaticGraphDistribution distribution) {
+    constexpr SInt kNumVertices = 1000;
+
+    EdgeList directed_edges;
+    EdgeList symmetric_edges;
+    for (SInt u = 0; u < kNumVertices; ++u) {
+        for (const SInt v: {(u + 1) % kNumVertices, (u * 7) % kNumVertices, (u * 7) % kNumVertices}) {
+            directed_edges.emplace_back(u, v);
+            if (u != v) {
+                symmetric_edges.emplace_back(u, v);
+                symmetric_edges.emplace_back(v, u);
+            }
+        }
+    }
+    std::sort(directed_edges.begin(), directed_edges.end());
+    std::sort(symmetric_edges.begin(), symmetric_edges.end());
+    symmetric_edges.erase(std::unique(symmetric_edges.begin(), symmetric_edges.end()), symmetric_edges.end());
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank == ROOT) {
+        std::ofstream out("edge_list_test.txt");
+        out << "# Directed graph\n# FromNodeId\tToNodeId\n";
+        for (auto it = directed_edges.rbegin(); it != directed_edges.rend(); ++it) {
+            out << std::get<0>(*it) << "\t" << std::get<1>(*it) << "\n";
+        }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    auto static_config = CreateStaticConfig("edge_list_test.txt", StaticGraphFormat::EDGE_LIST, distribution);
+    for (const bool symmetrize: {false, true}) {
+        static_config.static_graph.symmetrize = symmetrize;
+        for (const auto representation: {GraphRepresentation::EDGE_LIST, GraphRepresentation::CSR}) {
+            const Graph loaded = Generate(static_config, representation, MPI_COMM_WORLD);
+            EXPECT_EQ(AllgatherVector(ToEdgeList(loaded)), symmetrize ? symmetric_edges : directed_edges);
+        }
+    }
+}
+} // namespace
+
+TEST(EdgeListTest, load_text_edge_list) {
+    TestEdgeListRoundTrip(
+        OutputFormat::EDGE_LIST, OutputHeader::ROOT, StaticGraphFormat::EDGE_LIST,
+        StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(EdgeListTest, load_text_edge_list_without_header) {
+    TestEdgeListRoundTrip(
+        OutputFormat::EDGE_LIST, OutputHeader::NEVER, StaticGraphFormat::EDGE_LIST,
+        StaticGraphDistribution::BALANCE_EDGES);
+}
+
+TEST(EdgeListTest, load_binary_edge_list) {
+    TestEdgeListRoundTrip(
+        OutputFormat::BINARY_EDGE_LIST, OutputHeader::ROOT, StaticGraphFormat::BINARY_EDGE_LIST,
+        StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(EdgeListTest, load_binary_edge_list32_without_header) {
+    TestEdgeListRoundTrip(
+        OutputFormat::BINARY_EDGE_LIST32, OutputHeader::NEVER, StaticGraphFormat::BINARY_EDGE_LIST32,
+        StaticGraphDistribution::BALANCE_EDGES);
+}
+
+TEST(EdgeListTest, load_snap_edge_list_with_balanced_vertices) {
+    TestSnapEdgeList(StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(EdgeListTest, load_snap_edge_list_with_balanced_edges) {
+    TestSnapEdgeList(StaticGraphDistribution::BALANCE_EDGES);
+}
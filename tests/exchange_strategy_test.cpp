@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+#include "kagen/io/io.h"
+
+#include "gather.h"
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+PGeneratorConfig CreateConfig(const GeneratorType type) {
+    PGeneratorConfig config;
+    config.generator        = type;
+    config.n                = 1 << 12;
+    config.m                = 1 << 15;
+    config.avg_degree       = 8;
+    config.min_degree       = 4;
+    config.plexp            = 2.6;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+    return config;
+}
+
+// The sparse and grid exchanges must deliver the same edges to each PE as the dense exchange
+void TestExchangeStrategies(PGeneratorConfig config, const GraphRepresentation representation) {
+    config.exchange_strategy = ExchangeStrategy::DENSE;
+    const Graph dense        = Generate(config, representation, MPI_COMM_WORLD);
+
+    EdgeList expected_edges = ToEdgeList(dense);
+    std::sort(expected_edges.begin(), expected_edges.end());
+    ASSERT_FALSE(AllgatherVector(expected_edges).empty());
+
+    for (const auto strategy: {ExchangeStrategy::SPARSE, ExchangeStrategy::GRID}) {
+        config.exchange_strategy = strategy;
+        const Graph graph        = Generate(config, representation, MPI_COMM_WORLD);
+
+        EdgeList actual_edges = ToEdgeList(graph);
+        std::sort(actual_edges.begin(), actual_edges.end());
+
+        EXPECT_EQ(graph.vertex_range, dense.vertex_range) << "strategy " << strategy;
+        EXPECT_EQ(actual_edges, expected_edges) << "strategy " << strategy;
+    }
+}
+
+// Writes a directed graph as edge list, which is then loaded with reverse edges
+PGeneratorConfig CreateSymmetrizeConfig(const StaticGraphDistribution distribution) {
+    PGeneratorConfig config = CreateConfig(GeneratorType::GNM_DIRECTED);
+    config.output_format    = OutputFormat::EDGE_LIST;
+    config.output_file      = "exchange_strategy_test";
+
+    Graph graph = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+
+    PGeneratorConfig static_config =
+        CreateStaticConfig("exchange_strategy_test.edgelist", StaticGraphFormat::EDGE_LIST, distribution);
+    static_config.static_graph.symmetrize = true;
+    return static_config;
+}
+} // namespace
+
+TEST(ExchangeStrategyTest, rhg) {
+    TestExchangeStrategies(CreateConfig(GeneratorType::RHG), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(ExchangeStrategyTest, rhg_csr) {
+    TestExchangeStrategies(CreateConfig(GeneratorType::RHG), GraphRepresentation::CSR);
+}
+
+TEST(ExchangeStrategyTest, rhg_with_memory_limit) {
+    PGeneratorConfig config = CreateConfig(GeneratorType::RHG);
+    config.memory_limit     = 64 * sizeof(EdgeList::value_type);
+    TestExchangeStrategies(config, GraphRepresentation::EDGE_LIST);
+}
+
+TEST(ExchangeStrategyTest, ba) {
+    TestExchangeStrategies(CreateConfig(GeneratorType::BA), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(ExchangeStrategyTest, symmetrized_edge_list_with_balanced_vertices) {
+    TestExchangeStrategies(
+        CreateSymmetrizeConfig(StaticGraphDistribution::BALANCE_VERTICES), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(ExchangeStrategyTest, symmetrized_edge_list_with_balanced_edges) {
+    TestExchangeStrategies(CreateSymmetrizeConfig(StaticGraphDistribution::BALANCE_EDGES), GraphRepresentation::CSR);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <numeric>
+#include <vector>
+
+#include "kagen/definitions.h"
+
+namespace kagen {
+// Concatenates the vectors of all PEs in the order of their ranks
+template <typename T>
+std::vector<T> AllgatherVector(const std::vector<T>& data, MPI_Comm comm = MPI_COMM_WORLD) {
+    int size;
+    MPI_Comm_size(comm, &size);
+
+    const int        num_bytes = static_cast<int>(data.size() * sizeof(T));
+    std::vector<int> counts(size);
+    std::vector<int> displs(size);
+    MPI_Allgather(&num_bytes, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+
+    std::vector<T> ans((displs.back() + counts.back()) / sizeof(T));
+    MPI_Allgatherv(data.data(), num_bytes, MPI_BYTE, ans.data(), counts.data(), displs.data(), MPI_BYTE, comm);
+    return ans;
+}
+
+// Returns the local edges of the graph, independent of its representation
+inline EdgeList ToEdgeList(const Graph& graph) {
+    if (graph.representation == GraphRepresentation::EDGE_LIST) {
+        return graph.edges;
+    }
+
+    EdgeList edges;
+    for (SInt u = 0; u + 1 < graph.xadj.size(); ++u) {
+        for (SInt e = graph.xadj[u]; e < graph.xadj[u + 1]; ++e) {
+            edges.emplace_back(graph.vertex_range.first + u, graph.adjncy[e]);
+        }
+    }
+    return edges;
+}
+} // namespace kagen
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+void TestKaGenBinaryRoundTrip(const SSInt vertex_weight_offset, const StaticGraphDistribution distribution) {
+    RoundTrip round_trip;
+    round_trip.output_format = OutputFormat::KAGEN;
+    round_trip.input_format  = StaticGraphFormat::KAGEN;
+    round_trip.output_file   = "kagen_binary_test";
+    round_trip.input_file    = "kagen_binary_test.kagen";
+    round_trip.distribution  = distribution;
+    round_trip.vertex_weight = [=](const SInt u) {
+        return vertex_weight_offset + static_cast<SSInt>(u);
+    };
+    round_trip.edge_weight = [](const SInt u, const SInt v) {
+        return static_cast<SSInt>(u) - static_cast<SSInt>(v);
+    };
+    TestRoundTrip(round_trip);
+}
+} // namespace
+
+TEST(KaGenBinaryTest, round_trip_with_32bit_weights) {
+    TestKaGenBinaryRoundTrip(-100, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(KaGenBinaryTest, round_trip_with_64bit_weights) {
+    TestKaGenBinaryRoundTrip(1ll << 40, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(KaGenBinaryTest, round_trip_with_balanced_edges) {
+    TestKaGenBinaryRoundTrip(0, StaticGraphDistribution::BALANCE_EDGES);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/io/checksum.h"
+
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+// Writes the graph with distributed output, then loads it from the manifest with all PEs and with a single PE
+void TestManifestRoundTrip(
+    const OutputFormat format, const OutputHeader header, const StaticGraphDistribution distribution) {
+    RoundTrip round_trip;
+    round_trip.output_format      = format;
+    round_trip.input_format       = StaticGraphFormat::MANIFEST;
+    round_trip.output_file        = "manifest_test";
+    round_trip.input_file         = "manifest_test.binaryedgelist.manifest";
+    round_trip.output_header      = header;
+    round_trip.output_single_file = false;
+    round_trip.distribution       = distribution;
+    round_trip.load_on_single_pe  = true;
+    TestRoundTrip(round_trip);
+}
+} // namespace
+
+TEST(ManifestTest, incremental_checksum_matches_checksum_of_whole_data) {
+    std::vector<char> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+
+    // Pieces that are smaller than, equal to and larger than a word, and do not start at word boundaries
+    for (const std::size_t piece_size: {1, 3, 8, 13, 1000}) {
+        IncrementalChecksum checksum;
+        for (std::size_t pos = 0; pos < data.size(); pos += piece_size) {
+            checksum.Update(data.data() + pos, std::min(piece_size, data.size() - pos));
+        }
+        EXPECT_EQ(checksum.GetNumberOfBytes(), data.size());
+        EXPECT_EQ(checksum.GetChecksum(), ComputeChecksum(data.data(), data.size())) << "piece size " << piece_size;
+    }
+}
+
+TEST(ManifestTest, binary_edge_list_with_root_header) {
+    TestManifestRoundTrip(OutputFormat::BINARY_EDGE_LIST, OutputHeader::ROOT, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(ManifestTest, binary_edge_list32_without_header) {
+    TestManifestRoundTrip(OutputFormat::BINARY_EDGE_LIST32, OutputHeader::NEVER, StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(ManifestTest, binary_edge_list_with_balanced_edges) {
+    TestManifestRoundTrip(OutputFormat::BINARY_EDGE_LIST, OutputHeader::ALWAYS, StaticGraphDistribution::BALANCE_EDGES);
+}
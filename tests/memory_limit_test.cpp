@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+
+#include "gather.h"
+
+using namespace kagen;
+
+namespace {
+PGeneratorConfig CreateConfig(const GeneratorType type) {
+    PGeneratorConfig config;
+    config.generator        = type;
+    config.n                = 1 << 12;
+    config.m                = 1 << 15;
+    config.avg_degree       = 8;
+    config.min_degree       = 4;
+    config.plexp            = 2.6;
+    config.rmat_a           = 0.57;
+    config.rmat_b           = 0.19;
+    config.rmat_c           = 0.19;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+    return config;
+}
+
+// Spilling sorts the local edges and removes duplicates, but must not change the edge set of any PE
+void TestMemoryLimit(PGeneratorConfig config, const GraphRepresentation representation) {
+    const Graph in_memory = Generate(config, representation, MPI_COMM_WORLD);
+
+    // At most 64 edges are kept in memory, i.e., each PE writes many runs
+    config.memory_limit = 64 * sizeof(EdgeList::value_type);
+    const Graph spilled = Generate(config, representation, MPI_COMM_WORLD);
+
+    EdgeList expected_edges = ToEdgeList(in_memory);
+    std::sort(expected_edges.begin(), expected_edges.end());
+    expected_edges.erase(std::unique(expected_edges.begin(), expected_edges.end()), expected_edges.end());
+
+    EdgeList actual_edges = ToEdgeList(spilled);
+    std::sort(actual_edges.begin(), actual_edges.end());
+
+    ASSERT_FALSE(AllgatherVector(expected_edges).empty());
+    EXPECT_EQ(spilled.vertex_range, in_memory.vertex_range);
+    EXPECT_EQ(actual_edges, expected_edges);
+    EXPECT_EQ(AllgatherVector(actual_edges), AllgatherVector(expected_edges));
+}
+} // namespace
+
+TEST(MemoryLimitTest, gnm_directed) {
+    TestMemoryLimit(CreateConfig(GeneratorType::GNM_DIRECTED), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(MemoryLimitTest, gnm_directed_with_threads) {
+    // Each thread spills with its share of the limit; the threads of a PE write scratch files with the same rank
+    PGeneratorConfig config = CreateConfig(GeneratorType::GNM_DIRECTED);
+    config.num_threads      = 4;
+    TestMemoryLimit(config, GraphRepresentation::EDGE_LIST);
+}
+
+TEST(MemoryLimitTest, rgg2d_csr_with_threads) {
+    PGeneratorConfig config = CreateConfig(GeneratorType::RGG_2D);
+    config.num_threads      = 4;
+    TestMemoryLimit(config, GraphRepresentation::CSR);
+}
+
+TEST(MemoryLimitTest, rmat) {
+    TestMemoryLimit(CreateConfig(GeneratorType::RMAT), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(MemoryLimitTest, rhg) {
+    TestMemoryLimit(CreateConfig(GeneratorType::RHG), GraphRepresentation::EDGE_LIST);
+}
+
+TEST(MemoryLimitTest, rhg_csr) {
+    TestMemoryLimit(CreateConfig(GeneratorType::RHG), GraphRepresentation::CSR);
+}
+
+TEST(MemoryLimitTest, ba) {
+    TestMemoryLimit(CreateConfig(GeneratorType::BA), GraphRepresentation::EDGE_LIST);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+#include "kagen/generators/static/metis.h"
+#include "kagen/io/io.h"
+
+#include "gather.h"
+#include "round_trip.h"
+
+using namespace kagen;
+
+namespace {
+// Writes a random graph with vertex and edge weights to metis_test.graph and returns all edges and weights
+std::tuple<EdgeList, VertexWeights, EdgeWeights> WriteMetisGraph() {
+    PGeneratorConfig config;
+    config.generator        = GeneratorType::GNM_UNDIRECTED;
+    config.n                = 1 << 14;
+    config.m                = 1 << 16;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+
+    Graph graph = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+    std::sort(graph.edges.begin(), graph.edges.end());
+    for (SInt u = graph.vertex_range.first; u < graph.vertex_range.second; ++u) {
+        graph.vertex_weights.push_back(static_cast<SSInt>(u % 7 + 1));
+    }
+    for (const auto& [u, v]: graph.edges) {
+        graph.edge_weights.push_back(static_cast<SSInt>((u + v) % 5 + 1));
+    }
+
+    config.output_format = OutputFormat::METIS;
+    config.output_file   = "metis_test";
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+
+    return {AllgatherVector(graph.edges), AllgatherVector(graph.vertex_weights), AllgatherVector(graph.edge_weights)};
+}
+
+// Each PE parses a byte range of the file with `num_threads` threads; the vertices are redistributed afterwards
+void TestParallelLoad(const StaticGraphDistribution distribution, const int num_threads = 1) {
+    const auto [expected_edges, expected_vertex_weights, expected_edge_weights] = WriteMetisGraph();
+
+    PGeneratorConfig static_config = CreateStaticConfig("metis_test.graph", StaticGraphFormat::METIS, distribution);
+    static_config.num_threads      = num_threads;
+
+    for (const auto representation: {GraphRepresentation::EDGE_LIST, GraphRepresentation::CSR}) {
+        const Graph loaded = Generate(static_config, representation, MPI_COMM_WORLD);
+        EXPECT_EQ(AllgatherVector(ToEdgeList(loaded)), expected_edges);
+        EXPECT_EQ(AllgatherVector(loaded.vertex_weights), expected_vertex_weights);
+        EXPECT_EQ(AllgatherVector(loaded.edge_weights), expected_edge_weights);
+    }
+}
+
+// Reads the file in `num_parts` parts with the sequential reader, without and with its index sidecar
+void TestLoadWithIndex(const SInt num_parts) {
+    const auto [expected_edges, expected_vertex_weights, expected_edge_weights] = WriteMetisGraph();
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank != ROOT) {
+        return;
+    }
+
+    const std::string index_filename = "metis_test.graph.idx";
+    std::remove(index_filename.c_str());
+
+    for (const bool with_index: {false, true}) {
+        staticgraph::MetisReader reader("metis_test.graph");
+        const auto [n, m] = reader.ReadSize();
+
+        EdgeList edges;
+        for (SInt part = 0; part < num_parts; ++part) {
+            const SInt  from  = reader.FindNodeByEdge(m * part / num_parts);
+            const Graph graph = reader.Read(
+                from, std::numeric_limits<SInt>::max(), m * (part + 1) / num_parts, GraphRepresentation::EDGE_LIST);
+            edges.insert(edges.end(), graph.edges.begin(), graph.edges.end());
+        }
+
+        EXPECT_EQ(edges, expected_edges);
+        EXPECT_EQ(std::ifstream(index_filename).good(), true) << "with_index=" << with_index;
+    }
+}
+} // namespace
+
+TEST(MetisTest, parallel_load_with_balanced_vertices) {
+    TestParallelLoad(StaticGraphDistribution::BALANCE_VERTICES);
+}
+
+TEST(MetisTest, parallel_load_with_balanced_edges) {
+    TestParallelLoad(StaticGraphDistribution::BALANCE_EDGES);
+}
+
+TEST(MetisTest, parallel_load_with_multiple_threads) {
+    TestParallelLoad(StaticGraphDistribution::BALANCE_VERTICES, 4);
+}
+
+TEST(MetisTest, load_in_one_part_with_index) {
+    TestLoadWithIndex(1);
+}
+
+TEST(MetisTest, load_in_seven_parts_with_index) {
+    TestLoadWithIndex(7);
+}
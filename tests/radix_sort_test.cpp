@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "kagen/definitions.h"
+#include "kagen/tools/radix_sort.h"
+
+using namespace kagen;
+
+namespace {
+EdgeList GenerateRandomEdges(const SInt num_edges, const SInt max_vertex) {
+    std::mt19937_64                     gen(42);
+    std::uniform_int_distribution<SInt> dist(0, max_vertex);
+
+    EdgeList edges;
+    for (SInt e = 0; e < num_edges; ++e) {
+        edges.emplace_back(dist(gen), dist(gen));
+    }
+    return edges;
+}
+
+void ExpectSortedLikeStdSort(EdgeList edges, const int num_threads = radix_sort::GetMaxThreads()) {
+    EdgeList expected = edges;
+    std::sort(expected.begin(), expected.end());
+    RadixSortEdges(edges, num_threads);
+    EXPECT_EQ(edges, expected);
+}
+} // namespace
+
+TEST(RadixSortTest, sorts_small_edge_list) {
+    ExpectSortedLikeStdSort(GenerateRandomEdges(1000, 100));
+}
+
+TEST(RadixSortTest, sorts_edge_list_with_few_vertices) {
+    ExpectSortedLikeStdSort(GenerateRandomEdges(1 << 18, 3));
+}
+
+TEST(RadixSortTest, sorts_edge_list_with_many_vertices) {
+    ExpectSortedLikeStdSort(GenerateRandomEdges(1 << 18, std::numeric_limits<VertexID>::max()));
+}
+
+TEST(RadixSortTest, sorts_edge_list_with_given_number_of_threads) {
+    for (const int num_threads: {0, 1, 3}) {
+        ExpectSortedLikeStdSort(GenerateRandomEdges(1 << 18, 1 << 20), num_threads);
+    }
+}
+
+TEST(RadixSortTest, removes_duplicate_edges) {
+    EdgeList edges = GenerateRandomEdges(1 << 18, 255);
+    edges.insert(edges.end(), edges.begin(), edges.end());
+
+    EdgeList expected = edges;
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+    RadixSortAndDeduplicateEdges(edges);
+    EXPECT_EQ(edges, expected);
+}
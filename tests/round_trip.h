@@ -0,0 +1,100 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+#include "kagen/io/io.h"
+
+#include "gather.h"
+
+namespace kagen {
+// Configuration that loads `filename` as a static graph
+inline PGeneratorConfig CreateStaticConfig(
+    const std::string& filename, const StaticGraphFormat format, const StaticGraphDistribution distribution) {
+    PGeneratorConfig config;
+    config.generator                 = GeneratorType::STATIC_GRAPH;
+    config.quiet                     = true;
+    config.statistics_level          = StatisticsLevel::NONE;
+    config.static_graph.filename     = filename;
+    config.static_graph.format       = format;
+    config.static_graph.distribution = distribution;
+    return config;
+}
+
+// A graph that is written by WriteGraph() and loaded again as a static graph
+struct RoundTrip {
+    OutputFormat      output_format;
+    StaticGraphFormat input_format;
+
+    // Name of the written file(s) without extension resp. name of the file to load
+    std::string output_file;
+    std::string input_file;
+
+    OutputHeader            output_header      = OutputHeader::ROOT;
+    bool                    output_single_file = true;
+    StaticGraphDistribution distribution       = StaticGraphDistribution::BALANCE_VERTICES;
+
+    // Weights of the written graph, if set
+    std::function<SSInt(SInt)>       vertex_weight;
+    std::function<SSInt(SInt, SInt)> edge_weight;
+
+    // Additionally loads the whole graph on each PE
+    bool load_on_single_pe = false;
+};
+
+// Writes a random graph and loads it in both representations, which must yield the same edges and weights
+inline void TestRoundTrip(const RoundTrip& round_trip) {
+    PGeneratorConfig config;
+    config.generator        = GeneratorType::GNM_UNDIRECTED;
+    config.n                = 1 << 10;
+    config.m                = 1 << 13;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+
+    Graph graph = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+    std::sort(graph.edges.begin(), graph.edges.end());
+    if (round_trip.vertex_weight) {
+        for (SInt u = graph.vertex_range.first; u < graph.vertex_range.second; ++u) {
+            graph.vertex_weights.push_back(round_trip.vertex_weight(u));
+        }
+    }
+    if (round_trip.edge_weight) {
+        for (const auto& [u, v]: graph.edges) {
+            graph.edge_weights.push_back(round_trip.edge_weight(u, v));
+        }
+    }
+
+    const EdgeList      expected_edges          = AllgatherVector(graph.edges);
+    const VertexWeights expected_vertex_weights = AllgatherVector(graph.vertex_weights);
+    const EdgeWeights   expected_edge_weights   = AllgatherVector(graph.edge_weights);
+
+    config.output_format      = round_trip.output_format;
+    config.output_header      = round_trip.output_header;
+    config.output_single_file = round_trip.output_single_file;
+    config.output_file        = round_trip.output_file;
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+
+    const PGeneratorConfig static_config =
+        CreateStaticConfig(round_trip.input_file, round_trip.input_format, round_trip.distribution);
+    for (const auto representation: {GraphRepresentation::EDGE_LIST, GraphRepresentation::CSR}) {
+        const Graph loaded = Generate(static_config, representation, MPI_COMM_WORLD);
+        EXPECT_EQ(AllgatherVector(ToEdgeList(loaded)), expected_edges);
+        EXPECT_EQ(AllgatherVector(loaded.vertex_weights), expected_vertex_weights);
+        EXPECT_EQ(AllgatherVector(loaded.edge_weights), expected_edge_weights);
+
+        if (round_trip.load_on_single_pe) {
+            const Graph loaded_by_one_pe = Generate(static_config, representation, MPI_COMM_SELF);
+            EXPECT_EQ(ToEdgeList(loaded_by_one_pe), expected_edges);
+            EXPECT_EQ(loaded_by_one_pe.vertex_weights, expected_vertex_weights);
+            EXPECT_EQ(loaded_by_one_pe.edge_weights, expected_edge_weights);
+        }
+    }
+}
+} // namespace kagen
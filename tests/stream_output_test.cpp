@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#include "kagen/context.h"
+#include "kagen/definitions.h"
+#include "kagen/facade.h"
+#include "kagen/io/io.h"
+
+using namespace kagen;
+
+namespace {
+std::string ReadFile(const std::string& filename) {
+    std::ifstream in(filename, std::ios_base::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+// Writing the graph while generating it must produce the same file(s) as generating the graph first
+void TestStreamedOutput(const GeneratorType generator, const OutputFormat format, const bool single_file) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    PGeneratorConfig config;
+    config.generator          = generator;
+    config.n                  = 1 << 10;
+    config.m                  = 1 << 13;
+    config.r                  = 0.05;
+    config.quiet              = true;
+    config.statistics_level   = StatisticsLevel::NONE;
+    config.output_format      = format;
+    config.output_single_file = single_file;
+
+    config.output_file = "stream_output_test_materialized";
+    Graph graph        = Generate(config, GraphRepresentation::EDGE_LIST, MPI_COMM_WORLD);
+    WriteGraph(config, graph, MPI_COMM_WORLD);
+
+    config.output_file   = "stream_output_test_streamed";
+    config.stream_output = true;
+    GenerateAndWriteGraph(config, MPI_COMM_WORLD);
+
+    if (single_file && rank != ROOT) {
+        return;
+    }
+    const std::string suffix = std::string(format == OutputFormat::EDGE_LIST ? ".edgelist" : ".binaryedgelist")
+                               + (single_file ? "" : "." + std::to_string(rank));
+
+    const std::string expected = ReadFile("stream_output_test_materialized" + suffix);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(ReadFile("stream_output_test_streamed" + suffix), expected);
+}
+
+// Streaming drops edges with vertex IDs that do not fit into VertexID, thus the overflow must be detected on all PEs
+// before the edges are written; only overflows in builds with 32 bit vertex IDs
+void TestStreamedVertexIDOverflow(const SInt n) {
+    PGeneratorConfig config;
+    config.generator        = GeneratorType::GNM_UNDIRECTED;
+    config.n                = n;
+    config.m                = 1000;
+    config.quiet            = true;
+    config.statistics_level = StatisticsLevel::NONE;
+
+    auto             generator          = CreateStreamingGenerator(config, MPI_COMM_WORLD);
+    SInt             num_streamed_edges = 0;
+    CallbackEdgeSink sink([&](const EdgeList& edges) { num_streamed_edges += edges.size(); });
+    generator->SetEdgeSink(&sink, 64);
+    generator->Generate(GraphRepresentation::EDGE_LIST);
+
+    const bool expect_overflow = n - 1 > std::numeric_limits<VertexID>::max();
+    EXPECT_EQ(HasGlobalVertexIDOverflow(*generator, MPI_COMM_WORLD), expect_overflow);
+    if (!expect_overflow) {
+        EXPECT_EQ(num_streamed_edges, generator->GetNumberOfEdges());
+    }
+}
+} // namespace
+
+TEST(StreamOutputTest, gnm_edge_list_single_file) {
+    TestStreamedOutput(GeneratorType::GNM_UNDIRECTED, OutputFormat::EDGE_LIST, true);
+}
+
+TEST(StreamOutputTest, gnm_edge_list_distributed) {
+    TestStreamedOutput(GeneratorType::GNM_UNDIRECTED, OutputFormat::EDGE_LIST, false);
+}
+
+TEST(StreamOutputTest, rgg2d_binary_edge_list_single_file) {
+    TestStreamedOutput(GeneratorType::RGG_2D, OutputFormat::BINARY_EDGE_LIST, true);
+}
+
+TEST(StreamOutputTest, gnm_with_vertex_ids_beyond_32_bits) {
+    TestStreamedVertexIDOverflow(SInt{1} << 33);
+}
+
+TEST(StreamOutputTest, gnm_with_vertex_ids_within_32_bits) {
+    TestStreamedVertexIDOverflow(SInt{1} << 20);
+}